@@ -0,0 +1,115 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+// Compares boolean::Fuse() against boolean::FuseBalanced() on a lattice of
+// overlapping cubes. Usage:
+//
+//     occutils-benchmark-fuse [count...]
+//
+// Without arguments, lattices of 100, 1000 and 10000 cubes are fused.
+
+// std includes
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// OCC includes
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+#include "occutils/occutils-primitive.h"
+#include "occutils/occutils-shape.h"
+
+using namespace occutils;
+
+namespace
+{
+
+/**
+ * Create [count] unit cubes on a cubic grid. The grid spacing is smaller than
+ * the cube size, so every cube overlaps with its direct neighbours.
+ */
+NCollection_List<TopoDS_Shape> MakeCubeLattice(size_t count)
+{
+  constexpr double spacing = 0.8;
+  const auto       perAxis = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(count))));
+
+  NCollection_List<TopoDS_Shape> cubes;
+  for (size_t i = 0; i < count; i++)
+  {
+    const auto x = static_cast<double>(i % perAxis) * spacing;
+    const auto y = static_cast<double>((i / perAxis) % perAxis) * spacing;
+    const auto z = static_cast<double>(i / (perAxis * perAxis)) * spacing;
+    cubes.Append(
+      primitive::MakeCube(1.0, primitive::PositionCentering::DoNotCenter, gp_Pnt(x, y, z)));
+  }
+  return cubes;
+}
+
+/**
+ * Run the given fuse function and return the elapsed time in seconds
+ */
+template <typename FuseFunc>
+double Measure(const FuseFunc& fuse, TopoDS_Shape& result)
+{
+  const auto start = std::chrono::steady_clock::now();
+  result           = fuse();
+  const auto end   = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::vector<size_t> counts = {100, 1000, 10000};
+  if (argc > 1)
+  {
+    counts.clear();
+    for (int i = 1; i < argc; i++)
+    {
+      counts.push_back(std::strtoul(argv[i], nullptr, 10));
+    }
+  }
+
+  std::cout << std::setw(8) << "count" << std::setw(14) << "Fuse [s]" << std::setw(20)
+            << "FuseBalanced [s]" << std::setw(12) << "speedup" << std::setw(16) << "volume delta"
+            << '\n';
+
+  for (const size_t count : counts)
+  {
+    const NCollection_List<TopoDS_Shape> cubes = MakeCubeLattice(count);
+
+    TopoDS_Shape plain;
+    TopoDS_Shape balanced;
+    const double plainTime    = Measure([&] { return boolean::Fuse(cubes); }, plain);
+    const double balancedTime = Measure([&] { return boolean::FuseBalanced(cubes); }, balanced);
+
+    const double volumeDelta = plain.IsNull() || balanced.IsNull()
+                                 ? NAN
+                                 : std::abs(shape::Volume(plain) - shape::Volume(balanced));
+
+    std::cout << std::setw(8) << count << std::setw(14) << std::fixed << std::setprecision(3)
+              << plainTime << std::setw(20) << balancedTime << std::setw(12)
+              << plainTime / balancedTime << std::setw(16) << std::scientific << volumeDelta
+              << std::defaultfloat << '\n';
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+// std includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// OCC includes
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-topology-index.h"
+
+namespace occutils::shape_components
+{
+
+/**
+ * How the two faces meeting at an edge are connected.
+ */
+enum class Convexity : uint8_t
+{
+  Unknown, //!< Not classified, free/non-manifold edge or classification failed
+  Convex,  //!< The material angle is below 180 degrees, e.g. the outer edges of a box
+  Concave, //!< The material angle is above 180 degrees, e.g. the floor edges of a pocket
+  Smooth   //!< The faces are tangent along the edge, e.g. at a fillet
+};
+
+/**
+ * @class AdjacencyGraph
+ * @brief Face, edge and vertex adjacency of a shape in compressed sparse rows.
+ *
+ * Nodes are the integer IDs of a TopologyIndex, so a face, edge or vertex ID
+ * can be turned back into a TopoDS shape using TopologyIndex::Get(). All
+ * relations are stored as flat int arrays with one offset array each:
+ *
+ *  - face -> edges of the face (seam edges once)
+ *  - edge -> faces containing the edge, in ascending order
+ *  - edge -> vertices of the edge (closed edges once)
+ *  - face -> neighbouring faces, with the edge they share. Faces sharing
+ *    several edges are neighbours once per shared edge.
+ *
+ * Queries such as FaceNeighbors(), ReachableFaces() and FaceComponents() only
+ * touch these arrays, never TopoDS handles.
+ *
+ * Usage example:
+ * @code
+ * shape_components::TopologyIndex  index(shape);
+ * shape_components::AdjacencyGraph graph(index);
+ * // Group the faces of fillet chains
+ * auto isSmooth   = [&graph](int edge)
+ * { return graph.EdgeConvexity(edge) == shape_components::Convexity::Smooth; };
+ * auto components = graph.FaceComponents(isSmooth);
+ * @endcode
+ */
+class AdjacencyGraph
+{
+public:
+  /**
+   * @brief A read-only view of one row of a relation.
+   */
+  struct Row
+  {
+    const int* first = nullptr;
+    const int* last  = nullptr;
+
+    [[nodiscard]] const int* begin() const { return first; }
+    [[nodiscard]] const int* end() const { return last; }
+    [[nodiscard]] size_t     size() const { return static_cast<size_t>(last - first); }
+    [[nodiscard]] bool       empty() const { return first == last; }
+    int                      operator[](size_t i) const { return first[i]; }
+  };
+
+  /**
+   * @brief Builds the graph of the faces, edges and vertices of an index.
+   *
+   * @param index The index providing the node IDs. It is only used during
+   * construction.
+   * @param classifyConvexity Whether to classify the shared edges, see
+   * EdgeConvexity(). Classification evaluates the adjacent surfaces and is
+   * run in parallel. If false, every edge is Convexity::Unknown.
+   */
+  explicit AdjacencyGraph(const TopologyIndex& index, bool classifyConvexity = true);
+
+  /**
+   * @brief Builds the graph of a shape, using the IDs of TopologyIndex(shape).
+   */
+  explicit AdjacencyGraph(const TopoDS_Shape& shape, bool classifyConvexity = true);
+
+  [[nodiscard]] int NbFaces() const;
+  [[nodiscard]] int NbEdges() const;
+  [[nodiscard]] int NbVertices() const;
+
+  /**
+   * @return The edges of the given face.
+   */
+  [[nodiscard]] Row FaceEdges(int face) const;
+
+  /**
+   * @return The faces containing the given edge, in ascending order.
+   */
+  [[nodiscard]] Row EdgeFaces(int edge) const;
+
+  /**
+   * @return The vertices of the given edge.
+   */
+  [[nodiscard]] Row EdgeVertices(int edge) const;
+
+  /**
+   * @return The faces sharing an edge with the given face. The edge shared
+   * with the neighbour FaceNeighbors(face)[i] is FaceNeighborEdges(face)[i].
+   */
+  [[nodiscard]] Row FaceNeighbors(int face) const;
+
+  /**
+   * @return The shared edges parallel to FaceNeighbors(face).
+   */
+  [[nodiscard]] Row FaceNeighborEdges(int face) const;
+
+  /**
+   * @return How the two faces of the given edge are connected. Edges that do
+   * not have exactly two faces are Convexity::Unknown.
+   */
+  [[nodiscard]] Convexity EdgeConvexity(int edge) const;
+
+  /**
+   * Breadth-first search over the faces, starting at [startFace] and only
+   * crossing shared edges for which canCross(edge) is true.
+   *
+   * @return The reached faces in BFS order, starting with startFace.
+   *
+   * @throws OCCInvalidArgumentException if startFace is out of range.
+   */
+  template <typename EdgePredicate>
+  std::vector<int> ReachableFaces(int startFace, const EdgePredicate& canCross) const
+  {
+    if (startFace < 0 || startFace >= NbFaces())
+    {
+      throw OCCInvalidArgumentException("AdjacencyGraph ID out of range");
+    }
+    std::vector<int>  order;
+    std::vector<bool> visited(NbFaces(), false);
+    visited[startFace] = true;
+    order.push_back(startFace);
+    for (size_t head = 0; head < order.size(); head++)
+    {
+      const int face      = order[head];
+      const Row neighbors = FaceNeighbors(face);
+      const Row edges     = FaceNeighborEdges(face);
+      for (size_t i = 0; i < neighbors.size(); i++)
+      {
+        const int neighbor = neighbors[i];
+        if (!visited[neighbor] && canCross(edges[i]))
+        {
+          visited[neighbor] = true;
+          order.push_back(neighbor);
+        }
+      }
+    }
+    return order;
+  }
+
+  /**
+   * @return The faces reachable from [startFace] via shared edges.
+   */
+  [[nodiscard]] std::vector<int> ReachableFaces(int startFace) const;
+
+  /**
+   * Label the connected components of the faces, only connecting faces
+   * across shared edges for which canCross(edge) is true.
+   *
+   * @return The component of every face. Components are numbered from 0 in
+   * the order of their lowest face ID.
+   */
+  template <typename EdgePredicate>
+  std::vector<int> FaceComponents(const EdgePredicate& canCross) const
+  {
+    std::vector<int> components(NbFaces(), -1);
+    std::vector<int> queue;
+    int              componentCount = 0;
+    for (size_t start = 0; start < components.size(); start++)
+    {
+      if (components[start] >= 0)
+      {
+        continue;
+      }
+      components[start] = componentCount;
+      queue.assign(1, static_cast<int>(start));
+      for (size_t head = 0; head < queue.size(); head++)
+      {
+        const Row neighbors = FaceNeighbors(queue[head]);
+        const Row edges     = FaceNeighborEdges(queue[head]);
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+          const int neighbor = neighbors[i];
+          if (components[neighbor] < 0 && canCross(edges[i]))
+          {
+            components[neighbor] = componentCount;
+            queue.push_back(neighbor);
+          }
+        }
+      }
+      componentCount++;
+    }
+    return components;
+  }
+
+  /**
+   * @return The component of every face, connecting faces across all shared
+   * edges.
+   */
+  [[nodiscard]] std::vector<int> FaceComponents() const;
+
+private:
+  [[nodiscard]] static Row MakeRow(const std::vector<int>& offsets,
+                                   const std::vector<int>& values,
+                                   int                     row);
+
+  std::vector<int> m_faceEdgeOffsets;
+  std::vector<int> m_faceEdges;
+
+  std::vector<int> m_edgeFaceOffsets;
+  std::vector<int> m_edgeFaces;
+
+  std::vector<int> m_edgeVertexOffsets;
+  std::vector<int> m_edgeVertices;
+
+  std::vector<int> m_faceFaceOffsets;
+  std::vector<int> m_faceFaces;
+  std::vector<int> m_faceFaceEdges;
+
+  std::vector<Convexity> m_edgeConvexity;
+  int                    m_vertexCount = 0;
+};
+
+} // namespace occutils::shape_components
@@ -0,0 +1,107 @@
+#pragma once
+
+// std includes
+#include <string>
+#include <vector>
+
+// OCC includes
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+
+namespace occutils::boolean
+{
+
+/**
+ * A single, independent boolean operation of a batch
+ */
+struct Job
+{
+  /**
+   * The operation to run.
+   */
+  Operation operation = Operation::Cut;
+
+  /**
+   * The shapes to act as the main arguments for the operation.
+   */
+  NCollection_List<TopoDS_Shape> arguments;
+
+  /**
+   * The shapes to act as the tools for the operation.
+   */
+  NCollection_List<TopoDS_Shape> tools;
+
+  /**
+   * The options of the operation. Defaults to the library-wide options at the
+   * time the job is created. nonDestructive is always set, since jobs may
+   * share input shapes.
+   */
+  BooleanOptions options = DefaultOptions();
+
+  /**
+   * The wall-clock time the job may take, in seconds. Jobs running past their
+   * budget are cancelled and reported as Status::TimedOut. 0.0 disables the
+   * limit.
+   */
+  double timeBudgetSeconds = 0.0;
+};
+
+/**
+ * The result of a single job of a batch
+ */
+struct JobResult
+{
+  /**
+   * The result of the operation. Null unless status is Status::Done.
+   */
+  TopoDS_Shape shape;
+
+  /**
+   * The outcome of the job.
+   */
+  Status status = Status::Failed;
+
+  /**
+   * A description of the error, empty if the job succeeded.
+   */
+  std::string error;
+
+  /**
+   * The wall-clock time the job took, in seconds.
+   */
+  double seconds = 0.0;
+};
+
+/**
+ * Run many independent boolean operations concurrently.
+ *
+ * Every job runs in a single worker; a failing job does not affect the
+ * others. Jobs may share argument and tool shapes, which are never modified.
+ * Usage example:
+ * @code
+ * std::vector<boolean::Job> jobs;
+ * for (const Part& part : parts)
+ * {
+ *   boolean::Job job;
+ *   job.operation = boolean::Operation::Cut;
+ *   job.arguments.Append(part.stock);
+ *   job.tools.Append(part.shape);
+ *   jobs.push_back(job);
+ * }
+ * for (const boolean::JobResult& result : boolean::RunBatch(jobs))
+ * {
+ *   ...
+ * }
+ * @endcode
+ *
+ * @param jobs The jobs to run.
+ * @param maxWorkers The maximum number of jobs running at the same time. 0
+ * uses all threads of the OCCT default thread pool.
+ * @return One result per job, in the order of jobs.
+ */
+std::vector<JobResult> RunBatch(const std::vector<Job>& jobs, size_t maxWorkers = 0);
+
+} // namespace occutils::boolean
@@ -0,0 +1,200 @@
+#pragma once
+
+// std includes
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+// OCC includes
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+
+namespace occutils::boolean
+{
+
+/**
+ * @class ResultCache
+ * @brief A memory bounded LRU cache of boolean results, keyed by the
+ * geometric content of the inputs.
+ *
+ * Two calls hit the same entry if their arguments and tools have identical
+ * geometry and topology (regardless of whether they are the same TopoDS
+ * objects), the operation is the same and all options affecting the result
+ * are equal. This makes the cache effective for parametric regeneration,
+ * where unchanged features re-issue identical booleans on freshly built
+ * inputs.
+ *
+ * Lookups and insertions are thread-safe, so parallel callers can share a
+ * cache. Two threads missing on the same key concurrently both compute the
+ * result; the second insertion replaces the first.
+ *
+ * Usage example:
+ * @code
+ * boolean::ResultCache cache(512 * 1024 * 1024);
+ * TopoDS_Shape result = cache.Perform(boolean::Operation::Cut,
+ *                                     list_utils::ToOCCList({part}),
+ *                                     list_utils::ToOCCList({hole}));
+ * @endcode
+ *
+ * @note Cached results are shared between callers, not copied. Pass
+ * BooleanOptions::nonDestructive = true when feeding them into further boolean
+ * operations, so the cached shapes are never modified in place.
+ */
+class ResultCache
+{
+public:
+  /**
+   * @brief The content hash of a boolean operation including its inputs
+   */
+  struct Key
+  {
+    uint64_t first  = 0;
+    uint64_t second = 0;
+
+    bool operator==(const Key& other) const
+    {
+      return first == other.first && second == other.second;
+    }
+  };
+
+  /**
+   * @brief Creates an empty cache.
+   *
+   * @param maxBytes The maximum estimated memory of all cached results. The
+   * least recently used results are evicted once it is exceeded.
+   */
+  explicit ResultCache(size_t maxBytes = 256 * 1024 * 1024);
+
+  ResultCache(const ResultCache&)            = delete;
+  ResultCache& operator=(const ResultCache&) = delete;
+
+  /**
+   * @brief Returns the cached result of the given operation, or runs it and
+   * caches the result.
+   *
+   * Null results (failed operations) are not cached.
+   *
+   * @param operation The operation to run.
+   * @param arguments A list of shapes to act as the main arguments for the
+   * operation.
+   * @param tools A list of shapes to act as the tools for the operation.
+   * @param options The options of the operation.
+   * @return The result of the operation. Check if the shape is null before
+   * using it.
+   *
+   * @throws OCCInvalidArgumentException if the lists are invalid for the
+   * operation.
+   */
+  TopoDS_Shape Perform(Operation                             operation,
+                       const NCollection_List<TopoDS_Shape>& arguments,
+                       const NCollection_List<TopoDS_Shape>& tools,
+                       const BooleanOptions&                 options = DefaultOptions());
+
+  /**
+   * @brief Computes the key of the given operation.
+   *
+   * Options that do not change the result (runParallel, broadPhase) are not
+   * part of the key.
+   */
+  [[nodiscard]] static Key MakeKey(Operation                             operation,
+                                   const NCollection_List<TopoDS_Shape>& arguments,
+                                   const NCollection_List<TopoDS_Shape>& tools,
+                                   const BooleanOptions&                 options);
+
+  /**
+   * @brief Looks up the result cached for the given key and marks it as the
+   * most recently used one.
+   *
+   * @return true if a result was found.
+   */
+  bool Lookup(const Key& key, TopoDS_Shape& result);
+
+  /**
+   * @brief Caches the given result, evicting least recently used results if
+   * the memory bound is exceeded. Results larger than the memory bound are
+   * not cached.
+   */
+  void Insert(const Key& key, const TopoDS_Shape& result);
+
+  /**
+   * @brief Removes all cached results. The hit and miss counters are kept.
+   */
+  void Clear();
+
+  /**
+   * @return The number of lookups that found a result.
+   */
+  [[nodiscard]] size_t Hits() const;
+
+  /**
+   * @return The number of lookups that did not find a result.
+   */
+  [[nodiscard]] size_t Misses() const;
+
+  /**
+   * @return The number of cached results.
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * @return The estimated memory of all cached results, in bytes.
+   */
+  [[nodiscard]] size_t Bytes() const;
+
+private:
+  struct KeyHasher
+  {
+    size_t operator()(const Key& key) const
+    {
+      return static_cast<size_t>(key.first ^ (key.second * 0x9E3779B97F4A7C15ULL));
+    }
+  };
+
+  struct Entry
+  {
+    Key          key;
+    TopoDS_Shape shape;
+    size_t       bytes = 0;
+  };
+
+  /**
+   * @brief Evicts least recently used entries until the memory bound is met.
+   * Must be called with m_mutex locked.
+   */
+  void Evict();
+
+  /**
+   * @brief The maximum estimated memory of all cached results.
+   */
+  size_t m_maxBytes;
+
+  /**
+   * @brief The estimated memory of all cached results.
+   */
+  size_t m_bytes = 0;
+
+  /**
+   * @brief All entries, most recently used first.
+   */
+  std::list<Entry> m_entries;
+
+  /**
+   * @brief Maps every key to its entry.
+   */
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHasher> m_index;
+
+  /**
+   * @brief Guards m_entries, m_index and m_bytes.
+   */
+  mutable std::mutex m_mutex;
+
+  std::atomic<size_t> m_hits{0};
+  std::atomic<size_t> m_misses{0};
+};
+
+} // namespace occutils::boolean
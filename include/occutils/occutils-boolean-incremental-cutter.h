@@ -0,0 +1,210 @@
+#pragma once
+
+// std includes
+#include <vector>
+
+// OCC includes
+#include <Bnd_Box.hxx>
+#include <NCollection_UBTree.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+
+namespace occutils::boolean
+{
+
+/**
+ * @class IncrementalCutter
+ * @brief Subtracts a sequence of tools from a stock shape, e.g. to simulate
+ * material removal.
+ *
+ * The cutter keeps the current stock together with a spatial index (a
+ * bounding box tree) over its faces. Every tool is first tested against the
+ * index:
+ * - tools that touch no stock face and lie outside the material are skipped
+ *   without running a boolean operation,
+ * - all other tools are cut from the stock, after which only the faces that
+ *   were added by the cut are inserted into the index, while unchanged faces
+ *   keep their entries.
+ *
+ * Every call to Cut() records a StepStats entry, which allows to observe
+ * when the complexity of the stock starts to dominate the cutting time.
+ *
+ * Usage example:
+ * @code
+ * boolean::IncrementalCutter cutter(stock);
+ * for (const TopoDS_Shape& sweep : toolSweeps)
+ * {
+ *   cutter.Cut(sweep);
+ * }
+ * TopoDS_Shape machined = cutter.Stock();
+ * @endcode
+ *
+ * @note The cutter is not thread-safe.
+ */
+class IncrementalCutter
+{
+public:
+  /**
+   * @brief Statistics of a single call to Cut()
+   */
+  struct StepStats
+  {
+    /**
+     * Total wall-clock time of the step, in seconds.
+     */
+    double seconds = 0.0;
+
+    /**
+     * Time spent querying the face index, in seconds.
+     */
+    double querySeconds = 0.0;
+
+    /**
+     * Time spent in the boolean operation, in seconds.
+     */
+    double booleanSeconds = 0.0;
+
+    /**
+     * Time spent updating the face index, in seconds.
+     */
+    double indexSeconds = 0.0;
+
+    /**
+     * The number of stock faces whose bounding box touches the tool.
+     */
+    size_t candidateFaces = 0;
+
+    /**
+     * The number of stock faces after the step.
+     */
+    size_t stockFaces = 0;
+
+    /**
+     * True if the tool did not touch the stock and no boolean operation ran.
+     */
+    bool skipped = false;
+
+    /**
+     * True if the boolean operation failed. The stock is left unchanged.
+     */
+    bool failed = false;
+  };
+
+  /**
+   * @brief Creates a cutter for the given stock and indexes its faces.
+   *
+   * @param stock The initial stock shape.
+   * @param options The options used for every cut.
+   *
+   * @throws OCCInvalidArgumentException if the stock is null.
+   */
+  explicit IncrementalCutter(const TopoDS_Shape&   stock,
+                             const BooleanOptions& options = DefaultOptions());
+
+  IncrementalCutter(const IncrementalCutter&)            = delete;
+  IncrementalCutter& operator=(const IncrementalCutter&) = delete;
+
+  /**
+   * @brief Subtracts the given tool from the stock.
+   *
+   * @param tool The shape to remove from the stock.
+   * @return false if the boolean operation failed, in which case the stock is
+   * left unchanged.
+   *
+   * @throws OCCInvalidArgumentException if the tool is null.
+   */
+  bool Cut(const TopoDS_Shape& tool);
+
+  /**
+   * @return The current stock.
+   */
+  [[nodiscard]] const TopoDS_Shape& Stock() const;
+
+  /**
+   * @return The number of faces of the current stock.
+   */
+  [[nodiscard]] size_t FaceCount() const;
+
+  /**
+   * @return The faces of the current stock whose bounding box overlaps the
+   * given box.
+   */
+  [[nodiscard]] std::vector<TopoDS_Face> FacesNear(const Bnd_Box& box) const;
+
+  /**
+   * @return The statistics of every call to Cut(), in call order.
+   */
+  [[nodiscard]] const std::vector<StepStats>& Steps() const;
+
+private:
+  /**
+   * @brief An indexed stock face. Slots of faces that were removed from the
+   * stock stay in the tree until the next rebuild.
+   */
+  struct FaceSlot
+  {
+    TopoDS_Face face;
+    Bnd_Box     box;
+    bool        alive = true;
+  };
+
+  using FaceTree = NCollection_UBTree<int, Bnd_Box>;
+
+  /**
+   * @brief Collects the alive slots overlapping the given box.
+   */
+  [[nodiscard]] std::vector<int> Query(const Bnd_Box& box) const;
+
+  /**
+   * @brief Rebuilds the whole index from the current stock.
+   */
+  void Rebuild();
+
+  /**
+   * @brief Updates the index after the stock changed, reusing the slots of
+   * faces that are still part of the stock.
+   */
+  void Update();
+
+  /**
+   * @brief Checks whether the given tool, which touches no stock face, lies
+   * inside the material of the stock.
+   */
+  [[nodiscard]] bool IsInsideMaterial(const TopoDS_Shape& tool) const;
+
+  /**
+   * @brief The current stock.
+   */
+  TopoDS_Shape m_stock;
+
+  /**
+   * @brief The options used for every cut.
+   */
+  BooleanOptions m_options;
+
+  /**
+   * @brief All face slots, including the ones of removed faces.
+   */
+  std::vector<FaceSlot> m_slots;
+
+  /**
+   * @brief Maps every face of the current stock to its slot.
+   */
+  TopTools_DataMapOfShapeInteger m_faceSlots;
+
+  /**
+   * @brief The bounding box tree over all slots.
+   */
+  FaceTree m_tree;
+
+  /**
+   * @brief The statistics of every step.
+   */
+  std::vector<StepStats> m_steps;
+};
+
+} // namespace occutils::boolean
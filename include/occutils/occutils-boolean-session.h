@@ -0,0 +1,140 @@
+#pragma once
+
+// std includes
+#include <memory>
+
+// OCC includes
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+
+// Forward declarations
+class BOPAlgo_PaveFiller;
+
+namespace occutils::boolean
+{
+
+/**
+ * @class Session
+ * @brief Runs several boolean operations on the same arguments and tools
+ * while intersecting them only once.
+ *
+ * The intersection of all arguments and tools (BOPAlgo_PaveFiller) is the
+ * most expensive part of every boolean operation. A Session computes it once
+ * on construction and builds the results of Fuse(), Cut(), Common() and
+ * Section() from that shared state, so only the first operation pays for it.
+ *
+ * Usage example:
+ * @code
+ * boolean::Session session(part, tool);
+ * TopoDS_Shape removed = session.Common();
+ * TopoDS_Shape remains = session.Cut();
+ * @endcode
+ *
+ * @note A Session is not thread-safe, as all operations share the
+ * intersection data structure.
+ */
+class Session
+{
+public:
+  /**
+   * @brief Intersects the given arguments and tools.
+   *
+   * @param arguments A list of shapes to act as the main arguments.
+   * @param tools A list of shapes to act as the tools.
+   * @param options The options to configure the intersection and the
+   * operations built from it.
+   *
+   * @throws OCCInvalidArgumentException if either list is empty.
+   */
+  Session(const NCollection_List<TopoDS_Shape>& arguments,
+          const NCollection_List<TopoDS_Shape>& tools,
+          const BooleanOptions&                 options = DefaultOptions());
+
+  /**
+   * @brief Intersects the given argument and tool.
+   *
+   * @param argument The shape to act as the main argument.
+   * @param tool The shape to act as the tool.
+   * @param options The options to configure the intersection and the
+   * operations built from it.
+   *
+   * @throws OCCInvalidArgumentException if either shape is null.
+   */
+  Session(const TopoDS_Shape&   argument,
+          const TopoDS_Shape&   tool,
+          const BooleanOptions& options = DefaultOptions());
+
+  ~Session();
+
+  Session(const Session&)            = delete;
+  Session& operator=(const Session&) = delete;
+
+  /**
+   * @brief Checks whether the intersection succeeded.
+   *
+   * If it did not, every operation returns a null shape.
+   */
+  [[nodiscard]] bool IsDone() const;
+
+  /**
+   * @return The union of arguments and tools. Check if the shape is null
+   * before using it.
+   */
+  [[nodiscard]] TopoDS_Shape Fuse() const;
+
+  /**
+   * @return The arguments minus the tools. Check if the shape is null before
+   * using it.
+   */
+  [[nodiscard]] TopoDS_Shape Cut() const;
+
+  /**
+   * @return The tools minus the arguments, e.g. the material added by a
+   * modification. Check if the shape is null before using it.
+   */
+  [[nodiscard]] TopoDS_Shape CutReversed() const;
+
+  /**
+   * @return The intersection of arguments and tools. Check if the shape is
+   * null before using it.
+   */
+  [[nodiscard]] TopoDS_Shape Common() const;
+
+  /**
+   * @return The section edges and vertices between arguments and tools.
+   * Check if the shape is null before using it.
+   */
+  [[nodiscard]] TopoDS_Shape Section() const;
+
+  /**
+   * @return The result of the given operation. Check if the shape is null
+   * before using it.
+   */
+  [[nodiscard]] TopoDS_Shape Perform(Operation operation) const;
+
+private:
+  /**
+   * @brief The shared intersection data structure.
+   */
+  std::unique_ptr<BOPAlgo_PaveFiller> m_filler;
+
+  /**
+   * @brief The arguments of all operations.
+   */
+  NCollection_List<TopoDS_Shape> m_arguments;
+
+  /**
+   * @brief The tools of all operations.
+   */
+  NCollection_List<TopoDS_Shape> m_tools;
+
+  /**
+   * @brief The options of all operations.
+   */
+  BooleanOptions m_options;
+};
+
+} // namespace occutils::boolean
@@ -1,11 +1,16 @@
 #pragma once
 
 // std includes
+#include <functional>
 #include <initializer_list>
+#include <string>
 #include <vector>
 
 // OCC includes
+#include <BOPAlgo_GlueEnum.hxx>
+#include <Message_ProgressRange.hxx>
 #include <NCollection_List.hxx>
+#include <Precision.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -19,6 +24,180 @@
 namespace occutils::boolean
 {
 
+/**
+ * The boolean operations provided by this module
+ */
+enum class Operation
+{
+  Fuse,
+  Cut,
+  Common,
+  Section
+};
+
+/**
+ * Outcome of a boolean operation
+ */
+enum class Status
+{
+  /**
+   * The operation succeeded, the result shape is valid.
+   */
+  Done,
+
+  /**
+   * The boolean algorithm failed or raised an exception.
+   */
+  Failed,
+
+  /**
+   * The operation was rejected before running, e.g. because of an empty list
+   * of arguments.
+   */
+  InvalidArgument,
+
+  /**
+   * The operation ran past its time budget and was cancelled.
+   */
+  TimedOut,
+
+  /**
+   * The operation was cancelled by its progress callback.
+   */
+  Cancelled
+};
+
+/**
+ * Broad phase used to drop tools that cannot interact with any argument
+ * before running Cut, Common or Section.
+ */
+enum class BroadPhase
+{
+  /**
+   * Pass every tool to the boolean algorithm.
+   */
+  None,
+
+  /**
+   * Drop tools whose axis-aligned bounding box does not overlap the box of
+   * any argument. Cheap, but loose for rotated or elongated shapes.
+   */
+  Box,
+
+  /**
+   * Drop tools whose oriented bounding box does not overlap the oriented box
+   * of any argument. More expensive to compute, but much tighter.
+   */
+  OrientedBox
+};
+
+/**
+ * Settings applied to the BRepAlgoAPI_* algorithm behind every boolean
+ * operation of this module.
+ *
+ * A default constructed BooleanOptions matches the OCCT defaults, i.e.
+ * passing it yields the same result as the plain BRepAlgoAPI_* algorithms.
+ */
+struct BooleanOptions
+{
+  /**
+   * Run the intersection and building stages on multiple threads.
+   */
+  bool runParallel = false;
+
+  /**
+   * Additional tolerance used to treat nearly coincident geometry as
+   * coincident. A value of 0.0 disables the fuzzy mode.
+   */
+  double fuzzyValue = 0.0;
+
+  /**
+   * Gluing mode for arguments sharing coinciding (but not intersecting)
+   * sub-shapes. Speeds up e.g. fusing touching boxes of a grid considerably.
+   */
+  BOPAlgo_GlueEnum glue = BOPAlgo_GlueOff;
+
+  /**
+   * Use oriented bounding boxes to filter out non-interfering sub-shapes
+   * before intersecting them.
+   */
+  bool useOBB = false;
+
+  /**
+   * Leave the input shapes untouched, i.e. copy sub-shapes instead of
+   * increasing their tolerances in place.
+   */
+  bool nonDestructive = false;
+
+  /**
+   * Check input solids for being inverted (i.e. having a reversed
+   * orientation of their shells). Disabling it saves time if the inputs
+   * are known to be valid.
+   */
+  bool checkInverted = true;
+
+  /**
+   * Broad phase to cull non-interacting tools before running Cut, Common or
+   * Section. Culling does not change the result, only the time to get it.
+   */
+  BroadPhase broadPhase = BroadPhase::None;
+
+  /**
+   * Merge coplanar face fragments and collinear edge splits of the result
+   * (same-domain unification). Keeps the results of long boolean chains
+   * compact, at the cost of an additional pass over every result.
+   */
+  bool unifySameDomain = false;
+};
+
+/**
+ * Set the library-wide options used by every boolean operation that is
+ * called without explicit options.
+ *
+ * Intended to be called once at application startup.
+ */
+void SetDefaultOptions(const BooleanOptions& options);
+
+/**
+ * Get the library-wide options used by every boolean operation that is
+ * called without explicit options.
+ */
+BooleanOptions DefaultOptions();
+
+/**
+ * Result of a broad phase run over a list of tools.
+ */
+struct CullResult
+{
+  /**
+   * The tools that may interact with the arguments, in input order.
+   */
+  NCollection_List<TopoDS_Shape> tools;
+
+  /**
+   * The number of tools that were dropped.
+   */
+  size_t culledCount = 0;
+};
+
+/**
+ * Drop all tools that cannot interact with any of the arguments, based on a
+ * bounding box overlap test. The box of every argument and every tool is
+ * computed once; tool boxes are computed in parallel for large lists.
+ *
+ * @param arguments The main arguments of the boolean operation.
+ * @param tools The tools of the boolean operation.
+ * @param mode The kind of bounding box to test. BroadPhase::None keeps every
+ * tool.
+ * @param gap Additional distance by which two boxes may be apart and still
+ * be considered overlapping, e.g. the fuzzy value of the operation.
+ * @return The remaining tools and the number of culled tools.
+ */
+CullResult CullTools(const NCollection_List<TopoDS_Shape>& arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     BroadPhase                            mode,
+                     double                                gap = 0.0);
+
 /**
  * Fuse two or more shapes in an OCC-style container.
  * Combines the shapes in the container into a single shape.
@@ -28,7 +207,8 @@ namespace occutils::boolean
  *
  * @throws OCCInvalidArgumentException if the list is empty.
  */
-TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& shapes);
+TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& shapes,
+                  const BooleanOptions&                 options = DefaultOptions());
 
 /**
  * Fuse with two lists of arguments.
@@ -37,13 +217,18 @@ TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& shapes);
  * @param arguments A list of shapes to act as the main arguments for the
  * fusion.
  * @param tools A list of shapes to act as additional tools for the fusion.
+ * @param options The options of the operation.
+ * @param progress The progress range to report progress to. Cancelling it
+ * through its indicator stops the operation, which then returns a null shape.
  * @return A fused shape representing the union of both lists. Check if the
  * shape is null before using it.
  *
  * @throws OCCInvalidArgumentException if either list is empty.
  */
 TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& arguments,
-                  const NCollection_List<TopoDS_Shape>& tools);
+                  const NCollection_List<TopoDS_Shape>& tools,
+                  const BooleanOptions&                 options  = DefaultOptions(),
+                  const Message_ProgressRange&          progress = Message_ProgressRange());
 
 /**
  * Fuse two or more shapes in an STL-like container.
@@ -56,9 +241,10 @@ TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& arguments,
  * container.
  */
 template <template <typename, typename> typename Container, typename Allocator>
-TopoDS_Shape Fuse(const Container<TopoDS_Shape, Allocator>& shapes)
+TopoDS_Shape Fuse(const Container<TopoDS_Shape, Allocator>& shapes,
+                  const BooleanOptions&                     options = DefaultOptions())
 {
-  return Fuse(occutils::list_utils::ToOCCList(shapes));
+  return Fuse(occutils::list_utils::ToOCCList(shapes), options);
 }
 
 /**
@@ -72,9 +258,10 @@ TopoDS_Shape Fuse(const Container<TopoDS_Shape, Allocator>& shapes)
  * container.
  */
 template <template <typename> typename Container>
-TopoDS_Shape Fuse(const Container<TopoDS_Shape>& shapes)
+TopoDS_Shape Fuse(const Container<TopoDS_Shape>& shapes,
+                  const BooleanOptions&          options = DefaultOptions())
 {
-  return Fuse(occutils::list_utils::ToOCCList(shapes));
+  return Fuse(occutils::list_utils::ToOCCList(shapes), options);
 }
 
 /**
@@ -90,7 +277,8 @@ TopoDS_Shape Fuse(const Container<TopoDS_Shape>& shapes)
  *
  * @throws OCCInvalidArgumentException if there is only one shape in the list.
  */
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes);
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes,
+                  const BooleanOptions&                      options = DefaultOptions());
 
 /**
  * Fuse two or more shapes in a vector of TopoDS_Solids.
@@ -103,7 +291,8 @@ TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes);
  * @throws OCCInvalidArgumentException if the vector is empty or contains only
  * one solid.
  */
-TopoDS_Shape Fuse(const std::vector<TopoDS_Solid>& shapes);
+TopoDS_Shape Fuse(const std::vector<TopoDS_Solid>& shapes,
+                  const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Fuse two or more shapes in an initializer list of TopoDS_Solids.
@@ -116,7 +305,8 @@ TopoDS_Shape Fuse(const std::vector<TopoDS_Solid>& shapes);
  * @throws OCCInvalidArgumentException if the list is empty or contains only one
  * solid.
  */
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Solid>& shapes);
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Solid>& shapes,
+                  const BooleanOptions&                      options = DefaultOptions());
 
 /**
  * Fuse two or more shapes in a vector of TopoDS_Faces.
@@ -129,7 +319,8 @@ TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Solid>& shapes);
  * @throws OCCInvalidArgumentException if the vector is empty or contains only
  * one face.
  */
-TopoDS_Shape Fuse(const std::vector<TopoDS_Face>& shapes);
+TopoDS_Shape Fuse(const std::vector<TopoDS_Face>& shapes,
+                  const BooleanOptions&           options = DefaultOptions());
 
 /**
  * Fuse two or more shapes in an initializer list of TopoDS_Faces.
@@ -142,7 +333,39 @@ TopoDS_Shape Fuse(const std::vector<TopoDS_Face>& shapes);
  * @throws OCCInvalidArgumentException if the list is empty or contains only one
  * face.
  */
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes);
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes,
+                  const BooleanOptions&                     options = DefaultOptions());
+
+/**
+ * Fuse a large number of shapes by balanced tree reduction.
+ *
+ * The shapes are clustered spatially by recursively splitting them at the
+ * median of their bounding box centers. Each cluster of at most [leafSize]
+ * shapes is fused on its own, then the partial results are fused pairwise up
+ * the tree. Clusters and pairs of the same tree level are fused concurrently.
+ * This scales much better than a single Fuse() when fusing thousands of small
+ * shapes (e.g. weld beads or lattice struts), as every single boolean
+ * operation stays small.
+ *
+ * Inputs with at most [leafSize] shapes are passed to Fuse() unchanged, so the
+ * result is identical to Fuse() for small inputs. For larger inputs, the
+ * non-destructive mode is forced on, as concurrent operations may share
+ * sub-shapes of the inputs.
+ *
+ * @param shapes A list of shapes to be fused together.
+ * @param options The options to configure every single fuse operation.
+ * @param leafSize The maximum number of shapes fused by a single operation at
+ * the leaves of the tree. Must be at least 2.
+ * @param maxThreads The maximum number of threads to use, 0 uses all
+ * available threads.
+ * @return A fused shape. Check if the shape is null before using it.
+ *
+ * @throws OCCInvalidArgumentException if leafSize is less than 2.
+ */
+TopoDS_Shape FuseBalanced(const NCollection_List<TopoDS_Shape>& shapes,
+                          const BooleanOptions&                 options    = DefaultOptions(),
+                          size_t                                leafSize   = 32,
+                          size_t                                maxThreads = 0);
 
 //------------------------------------------------------------------------------
 
@@ -154,13 +377,22 @@ TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes);
  * @param positive A list of shapes to act as the main arguments for the
  * operation.
  * @param negative A list of shapes to act as the tools for the operation.
+ * @param options The options of the operation. options.broadPhase enables
+ * culling of tools that do not touch any argument. If no tool remains after
+ * culling, the positive shapes are fused.
+ * @param culledTools If not null, receives the number of culled tools.
+ * @param progress The progress range to report progress to. Cancelling it
+ * through its indicator stops the operation, which then returns a null shape.
  * @return A shape representing the difference between the positive and negative
  * lists. Check if the shape is null before using it.
  *
  * @throws OCCInvalidArgumentException if either list is empty.
  */
 TopoDS_Shape Cut(const NCollection_List<TopoDS_Shape>& positive,
-                 const NCollection_List<TopoDS_Shape>& negative);
+                 const NCollection_List<TopoDS_Shape>& negative,
+                 const BooleanOptions&                 options     = DefaultOptions(),
+                 size_t*                               culledTools = nullptr,
+                 const Message_ProgressRange&          progress    = Message_ProgressRange());
 
 /**
  * Boolean subtraction between two shapes.
@@ -175,7 +407,9 @@ TopoDS_Shape Cut(const NCollection_List<TopoDS_Shape>& positive,
  *
  * @throws OCCInvalidArgumentException if either shape is null.
  */
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const TopoDS_Shape& negative);
+TopoDS_Shape Cut(const TopoDS_Shape&   positive,
+                 const TopoDS_Shape&   negative,
+                 const BooleanOptions& options = DefaultOptions());
 
 /**
  * Boolean subtraction between a shape and a list of arguments.
@@ -191,7 +425,9 @@ TopoDS_Shape Cut(const TopoDS_Shape& positive, const TopoDS_Shape& negative);
  * @throws OCCInvalidArgumentException if the positive shape is null or the list
  * of negative shapes is empty.
  */
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const NCollection_List<TopoDS_Shape>& negative);
+TopoDS_Shape Cut(const TopoDS_Shape&                   positive,
+                 const NCollection_List<TopoDS_Shape>& negative,
+                 const BooleanOptions&                 options = DefaultOptions());
 
 /**
  * Boolean subtraction between a shape and an initializer list of arguments.
@@ -209,7 +445,9 @@ TopoDS_Shape Cut(const TopoDS_Shape& positive, const NCollection_List<TopoDS_Sha
  * @throws OCCInvalidArgumentException if the positive shape is null or the list
  * of negative shapes is empty.
  */
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const std::initializer_list<TopoDS_Shape>& negative);
+TopoDS_Shape Cut(const TopoDS_Shape&                        positive,
+                 const std::initializer_list<TopoDS_Shape>& negative,
+                 const BooleanOptions&                      options = DefaultOptions());
 
 /**
  * Boolean subtraction between a shape and a variable shape container of
@@ -227,10 +465,13 @@ TopoDS_Shape Cut(const TopoDS_Shape& positive, const std::initializer_list<TopoD
  * container of negative shapes is empty.
  */
 template <template <typename, typename> typename Container, typename Allocator>
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const Container<TopoDS_Shape, Allocator>& negative)
+TopoDS_Shape Cut(const TopoDS_Shape&                       positive,
+                 const Container<TopoDS_Shape, Allocator>& negative,
+                 const BooleanOptions&                     options = DefaultOptions())
 {
   return Cut(occutils::list_utils::ToOCCList({positive}),
-             occutils::list_utils::ToOCCList(negative));
+             occutils::list_utils::ToOCCList(negative),
+             options);
 }
 
 /**
@@ -251,9 +492,12 @@ template <template <typename, typename> typename Container,
           typename Allocator1,
           typename Allocator2>
 TopoDS_Shape Cut(const Container<TopoDS_Shape, Allocator1>& positive,
-                 const Container<TopoDS_Shape, Allocator2>& negative)
+                 const Container<TopoDS_Shape, Allocator2>& negative,
+                 const BooleanOptions&                      options = DefaultOptions())
 {
-  return Cut(occutils::list_utils::ToOCCList(positive), occutils::list_utils::ToOCCList(negative));
+  return Cut(occutils::list_utils::ToOCCList(positive),
+             occutils::list_utils::ToOCCList(negative),
+             options);
 }
 
 /**
@@ -272,7 +516,8 @@ TopoDS_Shape Cut(const Container<TopoDS_Shape, Allocator1>& positive,
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Cut(const std::vector<TopoDS_Solid>& positive,
-                 const std::vector<TopoDS_Solid>& negative);
+                 const std::vector<TopoDS_Solid>& negative,
+                 const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean subtraction between a TopoDS_Solid and a vector of TopoDS_Solids.
@@ -289,7 +534,9 @@ TopoDS_Shape Cut(const std::vector<TopoDS_Solid>& positive,
  * @throws OCCInvalidArgumentException if the positive solid is null or the
  * vector of negative solids is empty.
  */
-TopoDS_Shape Cut(const TopoDS_Solid& positive, const std::vector<TopoDS_Solid>& negative);
+TopoDS_Shape Cut(const TopoDS_Solid&              positive,
+                 const std::vector<TopoDS_Solid>& negative,
+                 const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean subtraction between two vectors of TopoDS_Faces.
@@ -307,7 +554,8 @@ TopoDS_Shape Cut(const TopoDS_Solid& positive, const std::vector<TopoDS_Solid>&
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Cut(const std::vector<TopoDS_Face>& positive,
-                 const std::vector<TopoDS_Face>& negative);
+                 const std::vector<TopoDS_Face>& negative,
+                 const BooleanOptions&           options = DefaultOptions());
 
 /**
  * Boolean subtraction between a TopoDS_Face and a vector of TopoDS_Faces.
@@ -324,7 +572,9 @@ TopoDS_Shape Cut(const std::vector<TopoDS_Face>& positive,
  * @throws OCCInvalidArgumentException if the positive face is null or the
  * vector of negative faces is empty.
  */
-TopoDS_Shape Cut(const TopoDS_Face& positive, const std::vector<TopoDS_Face>& negative);
+TopoDS_Shape Cut(const TopoDS_Face&              positive,
+                 const std::vector<TopoDS_Face>& negative,
+                 const BooleanOptions&           options = DefaultOptions());
 
 //------------------------------------------------------------------------------
 
@@ -335,13 +585,23 @@ TopoDS_Shape Cut(const TopoDS_Face& positive, const std::vector<TopoDS_Face>& ne
  * @param arguments A list of shapes to act as the main arguments for the
  * operation.
  * @param tools A list of shapes to act as the tools for the operation.
+ * @param options The options of the operation. options.broadPhase enables
+ * culling of tools that do not touch any argument. If no tool remains after
+ * culling, an empty compound is returned without running the boolean
+ * algorithm.
+ * @param culledTools If not null, receives the number of culled tools.
+ * @param progress The progress range to report progress to. Cancelling it
+ * through its indicator stops the operation, which then returns a null shape.
  * @return A shape representing the intersection of the two lists. Check if the
  * shape is null before using it.
  *
  * @throws OCCInvalidArgumentException if either list is empty.
  */
 TopoDS_Shape Common(const NCollection_List<TopoDS_Shape>& arguments,
-                    const NCollection_List<TopoDS_Shape>& tools);
+                    const NCollection_List<TopoDS_Shape>& tools,
+                    const BooleanOptions&                 options     = DefaultOptions(),
+                    size_t*                               culledTools = nullptr,
+                    const Message_ProgressRange&          progress    = Message_ProgressRange());
 
 /**
  * Boolean intersection between two shapes.
@@ -355,7 +615,9 @@ TopoDS_Shape Common(const NCollection_List<TopoDS_Shape>& arguments,
  *
  * @throws OCCInvalidArgumentException if either shape is null.
  */
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const TopoDS_Shape& tools);
+TopoDS_Shape Common(const TopoDS_Shape&   arguments,
+                    const TopoDS_Shape&   tools,
+                    const BooleanOptions& options = DefaultOptions());
 
 /**
  * Boolean intersection between a shape and a list of shapes.
@@ -369,7 +631,9 @@ TopoDS_Shape Common(const TopoDS_Shape& arguments, const TopoDS_Shape& tools);
  *
  * @throws OCCInvalidArgumentException if either shape is null or list is empty.
  */
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const NCollection_List<TopoDS_Shape>& tools);
+TopoDS_Shape Common(const TopoDS_Shape&                   arguments,
+                    const NCollection_List<TopoDS_Shape>& tools,
+                    const BooleanOptions&                 options = DefaultOptions());
 
 /**
  * Boolean intersection between a shape and an initializer list of shapes.
@@ -385,7 +649,8 @@ TopoDS_Shape Common(const TopoDS_Shape& arguments, const NCollection_List<TopoDS
  * @throws OCCInvalidArgumentException if either shape is null or list is empty.
  */
 TopoDS_Shape Common(const TopoDS_Shape&                        arguments,
-                    const std::initializer_list<TopoDS_Shape>& tools);
+                    const std::initializer_list<TopoDS_Shape>& tools,
+                    const BooleanOptions&                      options = DefaultOptions());
 
 /**
  * Boolean intersection between a shape and a variable shape container of
@@ -403,10 +668,13 @@ TopoDS_Shape Common(const TopoDS_Shape&                        arguments,
  * empty.
  */
 template <template <typename, typename> typename Container, typename Allocator>
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const Container<TopoDS_Shape, Allocator>& tools)
+TopoDS_Shape Common(const TopoDS_Shape&                       arguments,
+                    const Container<TopoDS_Shape, Allocator>& tools,
+                    const BooleanOptions&                     options = DefaultOptions())
 {
   return Common(occutils::list_utils::ToOCCList({arguments}),
-                occutils::list_utils::ToOCCList(tools));
+                occutils::list_utils::ToOCCList(tools),
+                options);
 }
 
 /**
@@ -426,9 +694,12 @@ template <template <typename, typename> typename Container,
           typename Allocator1,
           typename Allocator2>
 TopoDS_Shape Common(const Container<TopoDS_Shape, Allocator1>& arguments,
-                    const Container<TopoDS_Shape, Allocator2>& tools)
+                    const Container<TopoDS_Shape, Allocator2>& tools,
+                    const BooleanOptions&                      options = DefaultOptions())
 {
-  return Common(occutils::list_utils::ToOCCList(arguments), occutils::list_utils::ToOCCList(tools));
+  return Common(occutils::list_utils::ToOCCList(arguments),
+                occutils::list_utils::ToOCCList(tools),
+                options);
 }
 
 /**
@@ -445,7 +716,8 @@ TopoDS_Shape Common(const Container<TopoDS_Shape, Allocator1>& arguments,
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Common(const std::vector<TopoDS_Solid>& arguments,
-                    const std::vector<TopoDS_Solid>& tools);
+                    const std::vector<TopoDS_Solid>& tools,
+                    const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean intersection between a TopoDS_Solid and a vector of TopoDS_Solids.
@@ -461,7 +733,9 @@ TopoDS_Shape Common(const std::vector<TopoDS_Solid>& arguments,
  * @throws OCCInvalidArgumentException if either TopoDS_Solid is null or vector
  * is empty.
  */
-TopoDS_Shape Common(const TopoDS_Solid& arguments, const std::vector<TopoDS_Solid>& tools);
+TopoDS_Shape Common(const TopoDS_Solid&              arguments,
+                    const std::vector<TopoDS_Solid>& tools,
+                    const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean intersection between two vectors of TopoDS_Faces.
@@ -477,7 +751,8 @@ TopoDS_Shape Common(const TopoDS_Solid& arguments, const std::vector<TopoDS_Soli
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Common(const std::vector<TopoDS_Face>& arguments,
-                    const std::vector<TopoDS_Face>& tools);
+                    const std::vector<TopoDS_Face>& tools,
+                    const BooleanOptions&           options = DefaultOptions());
 
 /**
  * Boolean intersection between a TopoDS_Face and a vector of TopoDS_Faces.
@@ -492,7 +767,9 @@ TopoDS_Shape Common(const std::vector<TopoDS_Face>& arguments,
  * @throws OCCInvalidArgumentException if either TopoDS_Face is null or vector
  * is empty.
  */
-TopoDS_Shape Common(const TopoDS_Face& arguments, const std::vector<TopoDS_Face>& tools);
+TopoDS_Shape Common(const TopoDS_Face&              arguments,
+                    const std::vector<TopoDS_Face>& tools,
+                    const BooleanOptions&           options = DefaultOptions());
 
 //------------------------------------------------------------------------------
 
@@ -504,13 +781,23 @@ TopoDS_Shape Common(const TopoDS_Face& arguments, const std::vector<TopoDS_Face>
  * @param positive A list of shapes to act as the main arguments for the
  * operation.
  * @param negative A list of shapes to act as the tools for the operation.
+ * @param options The options of the operation. options.broadPhase enables
+ * culling of tools that do not touch any argument. If no tool remains after
+ * culling, an empty compound is returned without running the boolean
+ * algorithm.
+ * @param culledTools If not null, receives the number of culled tools.
+ * @param progress The progress range to report progress to. Cancelling it
+ * through its indicator stops the operation, which then returns a null shape.
  * @return A shape representing the section between the two lists. Check if the
  * shape is null before using it.
  *
  * @throws OCCInvalidArgumentException if either list is empty.
  */
 TopoDS_Shape Section(const NCollection_List<TopoDS_Shape>& positive,
-                     const NCollection_List<TopoDS_Shape>& negative);
+                     const NCollection_List<TopoDS_Shape>& negative,
+                     const BooleanOptions&                 options     = DefaultOptions(),
+                     size_t*                               culledTools = nullptr,
+                     const Message_ProgressRange&          progress    = Message_ProgressRange());
 
 /**
  * Boolean section between two shapes.
@@ -524,7 +811,9 @@ TopoDS_Shape Section(const NCollection_List<TopoDS_Shape>& positive,
  *
  * @throws OCCInvalidArgumentException if either shape is null.
  */
-TopoDS_Shape Section(const TopoDS_Shape& arguments, const TopoDS_Shape& tools);
+TopoDS_Shape Section(const TopoDS_Shape&   arguments,
+                     const TopoDS_Shape&   tools,
+                     const BooleanOptions& options = DefaultOptions());
 
 /**
  * Boolean section between a shape and a list of tools.
@@ -539,7 +828,9 @@ TopoDS_Shape Section(const TopoDS_Shape& arguments, const TopoDS_Shape& tools);
  * @throws OCCInvalidArgumentException if the argument shape is null or the list
  * of tools is empty.
  */
-TopoDS_Shape Section(const TopoDS_Shape& arguments, const NCollection_List<TopoDS_Shape>& tools);
+TopoDS_Shape Section(const TopoDS_Shape&                   arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     const BooleanOptions&                 options = DefaultOptions());
 
 /**
  * Boolean section between a shape and an initializer list of tools.
@@ -557,7 +848,8 @@ TopoDS_Shape Section(const TopoDS_Shape& arguments, const NCollection_List<TopoD
  * of tools is empty.
  */
 TopoDS_Shape Section(const TopoDS_Shape&                        arguments,
-                     const std::initializer_list<TopoDS_Shape>& tools);
+                     const std::initializer_list<TopoDS_Shape>& tools,
+                     const BooleanOptions&                      options = DefaultOptions());
 
 /**
  * Boolean section between a shape and a variable shape container of arguments.
@@ -574,10 +866,13 @@ TopoDS_Shape Section(const TopoDS_Shape&                        arguments,
  * container is empty.
  */
 template <template <typename, typename> typename Container, typename Allocator>
-TopoDS_Shape Section(const TopoDS_Shape& arguments, const Container<TopoDS_Shape, Allocator>& tools)
+TopoDS_Shape Section(const TopoDS_Shape&                       arguments,
+                     const Container<TopoDS_Shape, Allocator>& tools,
+                     const BooleanOptions&                     options = DefaultOptions())
 {
   return Section(occutils::list_utils::ToOCCList({arguments}),
-                 occutils::list_utils::ToOCCList(tools));
+                 occutils::list_utils::ToOCCList(tools),
+                 options);
 }
 
 /**
@@ -597,10 +892,12 @@ template <template <typename, typename> typename Container,
           typename Allocator1,
           typename Allocator2>
 TopoDS_Shape Section(const Container<TopoDS_Shape, Allocator1>& arguments,
-                     const Container<TopoDS_Shape, Allocator2>& tools)
+                     const Container<TopoDS_Shape, Allocator2>& tools,
+                     const BooleanOptions&                      options = DefaultOptions())
 {
   return Section(occutils::list_utils::ToOCCList(arguments),
-                 occutils::list_utils::ToOCCList(tools));
+                 occutils::list_utils::ToOCCList(tools),
+                 options);
 }
 
 /**
@@ -616,7 +913,8 @@ TopoDS_Shape Section(const Container<TopoDS_Shape, Allocator1>& arguments,
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Section(const std::vector<TopoDS_Solid>& arguments,
-                     const std::vector<TopoDS_Solid>& tools);
+                     const std::vector<TopoDS_Solid>& tools,
+                     const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean section between a TopoDS_Solid and a vector of TopoDS_Solids.
@@ -631,7 +929,9 @@ TopoDS_Shape Section(const std::vector<TopoDS_Solid>& arguments,
  * @throws OCCInvalidArgumentException if the argument solid is null or the
  * vector of tools is empty.
  */
-TopoDS_Shape Section(const TopoDS_Solid& arguments, const std::vector<TopoDS_Solid>& tools);
+TopoDS_Shape Section(const TopoDS_Solid&              arguments,
+                     const std::vector<TopoDS_Solid>& tools,
+                     const BooleanOptions&            options = DefaultOptions());
 
 /**
  * Boolean section between two vectors of TopoDS_Face.
@@ -646,7 +946,8 @@ TopoDS_Shape Section(const TopoDS_Solid& arguments, const std::vector<TopoDS_Sol
  * @throws OCCInvalidArgumentException if either vector is empty.
  */
 TopoDS_Shape Section(const std::vector<TopoDS_Face>& arguments,
-                     const std::vector<TopoDS_Face>& tools);
+                     const std::vector<TopoDS_Face>& tools,
+                     const BooleanOptions&           options = DefaultOptions());
 
 /**
  * Boolean section between a TopoDS_Face and a vector of TopoDS_Faces.
@@ -660,6 +961,152 @@ TopoDS_Shape Section(const std::vector<TopoDS_Face>& arguments,
  * @throws OCCInvalidArgumentException if the argument face is null or the
  * vector of tools is empty.
  */
-TopoDS_Shape Section(const TopoDS_Face& arguments, const std::vector<TopoDS_Face>& tools);
+TopoDS_Shape Section(const TopoDS_Face&              arguments,
+                     const std::vector<TopoDS_Face>& tools,
+                     const BooleanOptions&           options = DefaultOptions());
+
+//------------------------------------------------------------------------------
+
+/**
+ * Result of a same-domain unification, see UnifySameDomain().
+ */
+struct UnifyResult
+{
+  /**
+   * The unified shape. Null if the unification failed.
+   */
+  TopoDS_Shape shape;
+
+  /**
+   * The number of distinct faces before and after the unification.
+   */
+  size_t facesBefore = 0;
+  size_t facesAfter  = 0;
+
+  /**
+   * The number of distinct edges before and after the unification.
+   */
+  size_t edgesBefore = 0;
+  size_t edgesAfter  = 0;
+};
+
+/**
+ * Merge faces lying on the same surface and edges lying on the same curve,
+ * e.g. the coplanar face fragments and collinear edge splits accumulated by a
+ * chain of boolean operations.
+ *
+ * @param shape The shape to unify.
+ * @param unifyFaces Merge faces lying on the same surface.
+ * @param unifyEdges Merge edges lying on the same curve.
+ * @param linearTolerance The tolerance to decide whether two faces or edges
+ * share the same geometry.
+ * @param angularTolerance The angular tolerance to decide whether two faces or
+ * edges share the same geometry.
+ * @return The unified shape and the face and edge counts before and after.
+ *
+ * @throws OCCInvalidArgumentException if the shape is null.
+ */
+UnifyResult UnifySameDomain(const TopoDS_Shape& shape,
+                            bool                unifyFaces       = true,
+                            bool                unifyEdges       = true,
+                            double              linearTolerance  = Precision::Confusion(),
+                            double              angularTolerance = Precision::Angular());
+
+//------------------------------------------------------------------------------
+
+/**
+ * Run the given boolean operation. For Operation::Fuse, arguments and tools
+ * are fused together.
+ *
+ * @param operation The operation to run.
+ * @param arguments A list of shapes to act as the main arguments for the
+ * operation.
+ * @param tools A list of shapes to act as the tools for the operation.
+ * @param options The options of the operation.
+ * @param culledTools If not null, receives the number of tools culled by the
+ * broad phase. Always 0 for Operation::Fuse.
+ * @param progress The progress range to report progress to. Cancelling it
+ * through its indicator stops the operation, which then returns a null shape.
+ * @return The result of the operation. Check if the shape is null before
+ * using it.
+ *
+ * @throws OCCInvalidArgumentException if the lists are invalid for the
+ * operation.
+ */
+TopoDS_Shape Perform(Operation                             operation,
+                     const NCollection_List<TopoDS_Shape>& arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     const BooleanOptions&                 options     = DefaultOptions(),
+                     size_t*                               culledTools = nullptr,
+                     const Message_ProgressRange&          progress    = Message_ProgressRange());
+
+//------------------------------------------------------------------------------
+
+/**
+ * Progress reporting and time limit of a controlled boolean operation.
+ */
+struct ProgressControl
+{
+  /**
+   * Called with the completed fraction (0.0 to 1.0) while the operation
+   * runs. Returning false cancels the operation. May be called from any of
+   * the threads running the operation, but never concurrently.
+   */
+  std::function<bool(double fraction)> onProgress;
+
+  /**
+   * The wall-clock time the operation may take, in seconds. The operation is
+   * cancelled once it runs past the budget. 0.0 disables the limit.
+   */
+  double timeBudgetSeconds = 0.0;
+};
+
+/**
+ * Result of a controlled boolean operation.
+ */
+struct ControlledResult
+{
+  /**
+   * The result of the operation. Null unless status is Status::Done.
+   */
+  TopoDS_Shape shape;
+
+  /**
+   * The outcome of the operation.
+   */
+  Status status = Status::Failed;
+
+  /**
+   * A description of the error, empty if the operation succeeded.
+   */
+  std::string error;
+
+  /**
+   * The wall-clock time the operation took, in seconds.
+   */
+  double seconds = 0.0;
+};
+
+/**
+ * Run the given boolean operation with progress reporting and a time budget.
+ *
+ * Cancellation is cooperative: OCCT checks for it between (and within) the
+ * stages of the algorithm, so the operation stops shortly after the budget is
+ * exceeded or the callback asks to cancel.
+ *
+ * @param operation The operation to run.
+ * @param arguments A list of shapes to act as the main arguments for the
+ * operation.
+ * @param tools A list of shapes to act as the tools for the operation.
+ * @param control The progress callback and time budget.
+ * @param options The options of the operation.
+ * @return The result and status of the operation. Invalid arguments are
+ * reported as Status::InvalidArgument instead of an exception.
+ */
+ControlledResult Perform(Operation                             operation,
+                         const NCollection_List<TopoDS_Shape>& arguments,
+                         const NCollection_List<TopoDS_Shape>& tools,
+                         const ProgressControl&                control,
+                         const BooleanOptions&                 options = DefaultOptions());
 
 } // namespace occutils::boolean
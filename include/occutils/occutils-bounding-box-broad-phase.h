@@ -0,0 +1,211 @@
+#pragma once
+
+// std includes
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// OCC includes
+#include <Bnd_Box.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-bounding-box.h"
+
+namespace occutils::bbox
+{
+
+/**
+ * @class SweepAndPrune
+ * @brief Broad phase finding the pairs of elements, e.g. the parts of an
+ * assembly, whose axis-aligned bounding boxes overlap.
+ *
+ * The element boxes are sorted by their minimum along one axis (the one along
+ * which the box centers spread the most) and swept in that order, so only
+ * elements whose intervals on that axis overlap are compared. The initial
+ * sort and the sweep run in parallel.
+ *
+ * Elements are either shapes or instances of parts placed at a location, as
+ * in an XDE assembly. Every distinct part is only bounded once, the boxes of
+ * its instances are its box transformed by their location.
+ *
+ * When a few elements moved, Move() or Update() them and Sort() again: the
+ * order is nearly sorted then, which takes linear time. Pairs(elements) only
+ * returns the pairs involving the moved elements.
+ *
+ * Usage example:
+ * @code
+ * bbox::SweepAndPrune broadPhase(parts);
+ * for (const auto& [first, second] : broadPhase.Pairs())
+ * {
+ *   // Exact clash test of parts[first] and parts[second]
+ * }
+ * @endcode
+ *
+ * @note Queries are thread-safe, Move(), Update() and Sort() are not.
+ */
+class SweepAndPrune
+{
+public:
+  /**
+   * @brief An instance of a part placed at a location.
+   */
+  struct Instance
+  {
+    TopoDS_Shape    part;
+    TopLoc_Location location;
+  };
+
+  /**
+   * @brief Builds the broad phase over the given shapes. Element i is
+   * shapes[i].
+   *
+   * @param shapes The shapes
+   * @param mode The accuracy of the boxes, see bbox::Compute()
+   * @param maxThreads The maximum number of threads to use (including the
+   * calling thread). 0 uses all threads of the pool.
+   */
+  explicit SweepAndPrune(const std::vector<TopoDS_Shape>& shapes,
+                         Mode                             mode       = Mode::Default,
+                         size_t                           maxThreads = 0);
+
+  /**
+   * @brief Builds the broad phase over the given instances. Element i is
+   * instances[i].part moved by instances[i].location.
+   *
+   * The box of an instance is the box of its part transformed by its
+   * location, which is looser than the box of the moved part if the location
+   * rotates it.
+   */
+  explicit SweepAndPrune(const std::vector<Instance>& instances,
+                         Mode                         mode       = Mode::Default,
+                         size_t                       maxThreads = 0);
+
+  SweepAndPrune(const SweepAndPrune&)            = delete;
+  SweepAndPrune& operator=(const SweepAndPrune&) = delete;
+
+  /**
+   * @return The number of elements.
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * @return The sweep axis: 0 for x, 1 for y or 2 for z.
+   */
+  [[nodiscard]] int Axis() const;
+
+  /**
+   * @return The boxes of the elements. Void boxes (elements without geometry)
+   * overlap nothing.
+   */
+  [[nodiscard]] const BoundingBoxArrays& Boxes() const;
+
+  /**
+   * @return All pairs (i, j) with i < j of elements whose boxes overlap or
+   * touch, in ascending order.
+   */
+  [[nodiscard]] std::vector<std::pair<size_t, size_t>> Pairs() const;
+
+  /**
+   * @return The pairs (i, j) with i < j of elements whose boxes overlap or
+   * touch, where i or j is one of the given elements, in ascending order.
+   *
+   * @throws OCCInvalidArgumentException if an element is out of range.
+   */
+  [[nodiscard]] std::vector<std::pair<size_t, size_t>> Pairs(
+    const std::vector<size_t>& elements) const;
+
+  /**
+   * @brief Place an element at a new location, relative to its part (or to
+   * its shape, for elements built from shapes). Call Sort() afterwards.
+   *
+   * @throws OCCInvalidArgumentException if the element is out of range.
+   */
+  void Move(size_t element, const TopLoc_Location& location);
+
+  /**
+   * @brief Replace the shape of an element and recompute its box. Call Sort()
+   * afterwards.
+   *
+   * For instances, the shape replaces the part of only this instance, which
+   * keeps its location. Other instances of the same part are not affected.
+   *
+   * @throws OCCInvalidArgumentException if the element is out of range.
+   */
+  void Update(size_t element, const TopoDS_Shape& shape);
+
+  /**
+   * @brief Restore the sweep order after Move() or Update(). After few
+   * changes, this is an insertion sort in linear time, else a parallel sort.
+   */
+  void Sort();
+
+private:
+  /**
+   * @brief The extent of an element along the sweep axis.
+   */
+  struct Interval
+  {
+    double min;
+    double max;
+    size_t element;
+  };
+
+  /**
+   * @brief Bound the parts in parallel, place the elements and sort them.
+   */
+  void Build();
+
+  /**
+   * @brief Set the box of an element to the box of its part transformed by
+   * its location.
+   */
+  void Place(size_t element);
+
+  /**
+   * @return true if the boxes of the given elements overlap or touch.
+   */
+  [[nodiscard]] bool Overlap(size_t first, size_t second) const;
+
+  /**
+   * @throws OCCInvalidArgumentException if the element is out of range.
+   */
+  void CheckElement(size_t element) const;
+
+  Mode   m_mode;
+  size_t m_maxThreads;
+
+  /**
+   * @brief The distinct parts with their boxes.
+   */
+  std::vector<TopoDS_Shape> m_parts;
+  std::vector<Bnd_Box>      m_partBoxes;
+
+  /**
+   * @brief The part and location of every element.
+   */
+  std::vector<size_t>          m_partOf;
+  std::vector<TopLoc_Location> m_locations;
+
+  BoundingBoxArrays m_boxes;
+
+  /**
+   * @brief The element intervals along the sweep axis, sorted by minimum.
+   */
+  std::vector<Interval> m_sorted;
+
+  /**
+   * @brief The largest extent of an element along the sweep axis.
+   */
+  double m_maxExtent = 0.0;
+
+  /**
+   * @brief The number of elements changed since the last Sort().
+   */
+  size_t m_changed = 0;
+
+  int m_axis = 0;
+};
+
+} // namespace occutils::bbox
@@ -0,0 +1,155 @@
+#pragma once
+
+// std includes
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <utility>
+
+// OCC includes
+#include <Bnd_Box.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Vec.hxx>
+#include <gp_XYZ.hxx>
+
+namespace occutils::bbox
+{
+
+/**
+ * @class Cache
+ * @brief A size bounded LRU cache of bounding boxes, keyed by TShape and
+ * location.
+ *
+ * Two shapes share an entry if they are the same (TopoDS_Shape::IsSame()),
+ * i.e. orientation does not matter but location does. The box of a compound
+ * is the union of the cached boxes of its located children, so a part that
+ * appears in several assemblies is only bounded once per location.
+ *
+ * The cache cannot detect geometry that is modified in place. Call
+ * Invalidate() for modified shapes and all compounds containing them, or
+ * Clear() the cache.
+ *
+ * All methods are thread-safe. Boxes are computed outside of the lock, so
+ * two threads missing on the same shape concurrently both compute its box.
+ *
+ * Usage example:
+ * @code
+ * bbox::Cache cache;
+ * for (const TopoDS_Shape& part : parts)
+ * {
+ *   double volume = cache.Volume(part);
+ *   gp_XYZ size   = cache.Size(part);  // Cache hit
+ * }
+ * @endcode
+ */
+class Cache
+{
+public:
+  /**
+   * @brief Creates an empty cache.
+   *
+   * @param maxEntries The maximum number of cached boxes. The least recently
+   * used boxes are evicted once it is exceeded.
+   */
+  explicit Cache(size_t maxEntries = 100000);
+
+  Cache(const Cache&)            = delete;
+  Cache& operator=(const Cache&) = delete;
+
+  /**
+   * @return The bounding box of the given shape, from the cache if possible.
+   * Void for a null shape.
+   */
+  Bnd_Box Box(const TopoDS_Shape& shape);
+
+  /**
+   * @brief Cached variant of bbox::BoundingBox().
+   */
+  std::pair<gp_Vec, gp_Vec> BoundingBox(const TopoDS_Shape& shape);
+
+  /**
+   * @brief Cached variant of bbox::Size().
+   */
+  gp_XYZ Size(const TopoDS_Shape& shape);
+
+  /**
+   * @brief Cached variant of bbox::Volume().
+   */
+  double Volume(const TopoDS_Shape& shape);
+
+  /**
+   * @brief Removes the boxes of the given shape at all locations. Boxes of
+   * compounds containing the shape are not removed.
+   */
+  void Invalidate(const TopoDS_Shape& shape);
+
+  /**
+   * @brief Removes all cached boxes. The hit and miss counters are kept.
+   */
+  void Clear();
+
+  /**
+   * @return The number of lookups that found a box.
+   */
+  [[nodiscard]] size_t Hits() const;
+
+  /**
+   * @return The number of lookups that did not find a box.
+   */
+  [[nodiscard]] size_t Misses() const;
+
+  /**
+   * @return The number of cached boxes.
+   */
+  [[nodiscard]] size_t Entries() const;
+
+private:
+  struct Entry
+  {
+    TopoDS_Shape shape;
+    Bnd_Box      box;
+  };
+
+  using EntryIterator = std::list<Entry>::iterator;
+
+  /**
+   * @brief Looks up the box cached for the given shape and marks it as the
+   * most recently used one.
+   *
+   * @return true if a box was found.
+   */
+  bool Lookup(const TopoDS_Shape& shape, Bnd_Box& box);
+
+  /**
+   * @brief Caches the box of the given shape, evicting the least recently
+   * used box if the size bound is exceeded.
+   */
+  void Insert(const TopoDS_Shape& shape, const Bnd_Box& box);
+
+  /**
+   * @brief The maximum number of cached boxes.
+   */
+  size_t m_maxEntries;
+
+  /**
+   * @brief All entries, most recently used first.
+   */
+  std::list<Entry> m_entries;
+
+  /**
+   * @brief Maps every shape (by TShape and location) to its entry.
+   */
+  NCollection_DataMap<TopoDS_Shape, EntryIterator, TopTools_ShapeMapHasher> m_index;
+
+  /**
+   * @brief Guards m_entries and m_index.
+   */
+  mutable std::mutex m_mutex;
+
+  std::atomic<size_t> m_hits{0};
+  std::atomic<size_t> m_misses{0};
+};
+
+} // namespace occutils::bbox
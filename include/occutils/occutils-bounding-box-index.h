@@ -0,0 +1,195 @@
+#pragma once
+
+// std includes
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// OCC includes
+#include <Bnd_Box.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Pnt.hxx>
+
+namespace occutils::bbox
+{
+
+/**
+ * @class Index
+ * @brief Bounding volume hierarchy over a set of shapes, e.g. the faces or
+ * solids of a shape or the parts of an assembly.
+ *
+ * Every element of the index is a shape with its axis-aligned bounding box.
+ * The boxes are computed in parallel; the hierarchy is a binary tree split at
+ * the median of the box centers along their widest axis.
+ *
+ * Overlap and ray queries return the elements whose box is hit, so they are
+ * conservative candidates for an exact test. Nearest neighbour queries use
+ * the exact distance to the element (BRepExtrema_DistShapeShape), but only
+ * compute it for elements whose box is closer than the best result so far.
+ *
+ * After elements moved slightly, Update() their shapes and Refit() the tree
+ * instead of rebuilding it. The tree structure is kept, so queries stay
+ * correct but get slower if elements moved far.
+ *
+ * Usage example:
+ * @code
+ * bbox::Index index(shape, TopAbs_FACE);
+ * for (size_t element : index.Overlapping(box))
+ * {
+ *   const TopoDS_Face& face = TopoDS::Face(index.Shape(element));
+ *   ...
+ * }
+ * @endcode
+ *
+ * @note Queries are thread-safe, Update() and Refit() are not.
+ */
+class Index
+{
+public:
+  /**
+   * @brief Builds the index over the distinct sub-shapes of the given type.
+   *
+   * Element IDs follow the order of TopExp::MapShapes(), which is the order of
+   * shape_components::TopologyIndex.
+   *
+   * @param shape The shape to index
+   * @param type The sub-shape type to index, e.g. TopAbs_FACE or TopAbs_SOLID
+   * @param maxThreads The maximum number of threads to use (including the
+   * calling thread). 0 uses all threads of the pool.
+   */
+  Index(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, size_t maxThreads = 0);
+
+  /**
+   * @brief Builds the index over the given shapes, e.g. the located parts of
+   * an assembly. Element i is shapes[i].
+   */
+  explicit Index(const std::vector<TopoDS_Shape>& shapes, size_t maxThreads = 0);
+
+  Index(const Index&)            = delete;
+  Index& operator=(const Index&) = delete;
+
+  /**
+   * @return The number of elements.
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * @return The shape of the given element.
+   */
+  [[nodiscard]] const TopoDS_Shape& Shape(size_t element) const;
+
+  /**
+   * @return The bounding box of the given element. Void for elements without
+   * geometry, which are never returned by queries.
+   */
+  [[nodiscard]] const Bnd_Box& Box(size_t element) const;
+
+  /**
+   * @return The elements whose bounding box overlaps the given box, in
+   * ascending order.
+   */
+  [[nodiscard]] std::vector<size_t> Overlapping(const Bnd_Box& box) const;
+
+  /**
+   * @return The elements whose bounding box is hit by the ray (a half-line
+   * starting at ray.Location()), ordered by the distance at which the ray
+   * enters their box.
+   */
+  [[nodiscard]] std::vector<size_t> HitByRay(const gp_Ax1& ray) const;
+
+  /**
+   * @param point The query point
+   * @param distance If not null, receives the distance to the nearest element
+   *
+   * @return The element nearest to the point, or no value if the index has no
+   * element with geometry.
+   */
+  [[nodiscard]] std::optional<size_t> Nearest(const gp_Pnt& point,
+                                              double*       distance = nullptr) const;
+
+  /**
+   * @return The (up to) k elements nearest to the point, nearest first.
+   */
+  [[nodiscard]] std::vector<size_t> KNearest(const gp_Pnt& point, size_t k) const;
+
+  /**
+   * @brief Replace the shape of an element, e.g. by a moved copy, and
+   * recompute its box. Call Refit() afterwards to update the tree.
+   *
+   * Elements without geometry are not part of the tree. If the element gains
+   * or loses its geometry, the tree is rebuilt right away, which is as
+   * expensive as building a new index.
+   *
+   * @throws OCCInvalidArgumentException if the element is out of range.
+   */
+  void Update(size_t element, const TopoDS_Shape& shape);
+
+  /**
+   * @brief Recompute the boxes of the tree nodes from the element boxes,
+   * keeping the tree structure.
+   */
+  void Refit();
+
+private:
+  /**
+   * @brief Axis-aligned box of a tree node, without the gaps and flags of
+   * Bnd_Box.
+   */
+  struct Bounds
+  {
+    double min[3];
+    double max[3];
+  };
+
+  /**
+   * @brief A tree node. Leaves have count > 0 and refer to the elements
+   * m_order[first, first + count). Inner nodes have count == 0, their left
+   * child directly follows them and their right child is at [right].
+   */
+  struct Node
+  {
+    Bounds bounds;
+    int    right = -1;
+    int    first = 0;
+    int    count = 0;
+  };
+
+  /**
+   * @brief Compute the element boxes in parallel and build the tree.
+   */
+  void Build(size_t maxThreads);
+
+  /**
+   * @brief Build the tree over all elements with geometry from the element
+   * boxes.
+   */
+  void BuildTree();
+
+  /**
+   * @brief Build the subtree over m_order[first, last) and return its node.
+   */
+  int BuildNode(size_t first, size_t last);
+
+  /**
+   * @return The (up to) k nearest elements with their distances, nearest
+   * first.
+   */
+  [[nodiscard]] std::vector<std::pair<double, size_t>> NearestWithDistances(const gp_Pnt& point,
+                                                                           size_t        k) const;
+
+  /**
+   * @return The exact distance between the point and the given element.
+   */
+  [[nodiscard]] double Distance(const gp_Pnt& point, size_t element) const;
+
+  std::vector<TopoDS_Shape> m_shapes;
+  std::vector<Bnd_Box>      m_boxes;
+  std::vector<Bounds>       m_bounds;
+  std::vector<size_t>       m_order;
+  std::vector<Node>         m_nodes;
+};
+
+} // namespace occutils::bbox
@@ -1,10 +1,13 @@
 #pragma once
 
 // std includes
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 // OCC includes
 #include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
 #include <Precision.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Vec.hxx>
@@ -32,6 +35,140 @@ gp_XYZ Size(const TopoDS_Shape& shape);
  */
 double Volume(const TopoDS_Shape& shape);
 
+//------------------------------------------------------------------------------
+
+/**
+ * How Compute() bounds a shape, from fastest to tightest.
+ */
+enum class Mode
+{
+  /**
+   * Bound the nodes of the existing face triangulations and of the 3D
+   * polygons of free edges, enlarged by the shape tolerances. No geometry is
+   * evaluated. Falls back to Default if any of them is missing.
+   */
+  Fast,
+
+  /**
+   * BRepBndLib::Add(), as used by BoundingBox(). Uses triangulations where
+   * available and the geometry otherwise, which may be loose, e.g. for
+   * BSpline surfaces bounded by their control points.
+   */
+  Default,
+
+  /**
+   * BRepBndLib::AddOptimal() on the exact geometry. Tight, but slower.
+   */
+  Optimal,
+
+  /**
+   * BRepBndLib::AddOBB(): an oriented box fitted to the shape, which fits
+   * rotated or elongated shapes far better than an axis-aligned one.
+   */
+  Oriented
+};
+
+/**
+ * Bounding box computed by Compute().
+ */
+struct BoundingBoxResult
+{
+  /**
+   * @brief The mode actually used, which differs from the requested one if
+   * Mode::Fast fell back to Mode::Default.
+   */
+  Mode mode = Mode::Default;
+
+  /**
+   * @brief The axis-aligned box. For Mode::Oriented, the axis-aligned box
+   * around the oriented one.
+   */
+  Bnd_Box box;
+
+  /**
+   * @brief The oriented box for Mode::Oriented, else the axis-aligned box as
+   * an oriented one.
+   */
+  Bnd_OBB obb;
+
+  /**
+   * @return The edge lengths of the box, i.e. of the oriented box along its
+   * own axes for Mode::Oriented.
+   */
+  [[nodiscard]] gp_XYZ Size() const;
+
+  /**
+   * @return The volume of the box, i.e. of the oriented box for
+   * Mode::Oriented.
+   */
+  [[nodiscard]] double Volume() const;
+};
+
+/**
+ * @brief Compute the bounding box of the given shape in the given mode.
+ *
+ * Usage example:
+ * @code
+ * // Tight box of a BSpline part, bounding its faces in parallel
+ * BoundingBoxResult result = bbox::Compute(shape, bbox::Mode::Optimal, true);
+ * @endcode
+ *
+ * @param shape The shape to bound
+ * @param mode The accuracy mode
+ * @param parallel For Mode::Optimal, bound the faces in parallel. Ignored by
+ * the other modes.
+ * @return The box and the mode actually used. The boxes are void if the shape
+ * is null or has no geometry.
+ */
+BoundingBoxResult Compute(const TopoDS_Shape& shape,
+                          Mode                mode     = Mode::Default,
+                          bool                parallel = false);
+
+/**
+ * @brief Axis-aligned boxes of many shapes as contiguous coordinate arrays,
+ * e.g. for vectorized overlap tests.
+ *
+ * Box i spans [xMin[i], xMax[i]] x [yMin[i], yMax[i]] x [zMin[i], zMax[i]].
+ * Void boxes have min = +infinity and max = -infinity, so they overlap
+ * nothing.
+ */
+struct BoundingBoxArrays
+{
+  std::vector<double> xMin;
+  std::vector<double> yMin;
+  std::vector<double> zMin;
+  std::vector<double> xMax;
+  std::vector<double> yMax;
+  std::vector<double> zMax;
+
+  /**
+   * @return The number of boxes.
+   */
+  [[nodiscard]] size_t Size() const { return xMin.size(); }
+};
+
+/**
+ * @brief Compute the axis-aligned boxes of many shapes in parallel.
+ *
+ * Usage example:
+ * @code
+ * // Boxes of the parts of an assembly from their existing triangulation
+ * BoundingBoxArrays boxes = bbox::BoundingBoxes(parts, bbox::Mode::Fast);
+ * @endcode
+ *
+ * @param shapes The shapes to bound. Box i is the box of shapes[i].
+ * @param mode The accuracy mode, see Compute(). With Mode::Fast, every shape
+ * without triangulation falls back to Mode::Default. With Mode::Oriented, the
+ * boxes are the axis-aligned boxes around the oriented ones.
+ * @param maxThreads The maximum number of threads to use (including the
+ * calling thread). 0 uses all threads of the pool.
+ */
+BoundingBoxArrays BoundingBoxes(const std::vector<TopoDS_Shape>& shapes,
+                                Mode                             mode       = Mode::Default,
+                                size_t                           maxThreads = 0);
+
+//------------------------------------------------------------------------------
+
 /**
  * @brief Check if the given bounding box is edgey (1D).
  *
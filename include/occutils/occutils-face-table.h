@@ -0,0 +1,180 @@
+#pragma once
+
+// std includes
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// OCC includes
+#include <GeomAbs_SurfaceType.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <TopAbs_Orientation.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_XY.hxx>
+
+// occutils includes
+#include "occutils/occutils-surface.h"
+
+namespace occutils::surfaces
+{
+
+/**
+ * @class FaceTable
+ * @brief Properties of many faces, computed once in parallel and stored
+ * column-wise.
+ *
+ * Row i holds the face, its surface adaptor, surface type, area, center of
+ * mass, U/V bounds and orientation. Area and center of mass come from a
+ * single GProp_GProps per face.
+ *
+ * Filters return row indices and only read the columns, so selecting e.g.
+ * all large planar faces does not touch the geometry again.
+ *
+ * Usage example:
+ * @code
+ * surfaces::FaceTable table(shape);
+ * auto planes = table.Only(GeomAbs_Plane);
+ * auto large  = table.Filter([&](size_t row) { return table.Area(row) > 100.0; });
+ * @endcode
+ *
+ * @note The row accessors throw OCCInvalidArgumentException if the row is
+ * out of range.
+ */
+class FaceTable
+{
+public:
+  /**
+   * @brief Builds the table over the distinct faces of the shape, in the
+   * order of TopExp::MapShapes() (i.e. of shape_components::TopologyIndex).
+   *
+   * @param shape The shape
+   * @param maxThreads The maximum number of threads to use (including the
+   * calling thread). 0 uses all threads of the pool.
+   */
+  explicit FaceTable(const TopoDS_Shape& shape, size_t maxThreads = 0);
+
+  /**
+   * @brief Builds the table over the given faces. Row i is faces[i].
+   */
+  explicit FaceTable(const std::vector<TopoDS_Face>& faces, size_t maxThreads = 0);
+
+  FaceTable(const FaceTable&)            = delete;
+  FaceTable& operator=(const FaceTable&) = delete;
+
+  /**
+   * @return The number of rows.
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * @return The face of the given row.
+   */
+  [[nodiscard]] const TopoDS_Face& Face(size_t row) const;
+
+  /**
+   * @return The surface of the given row, see surface::FromFace().
+   * Surface().IsNull() if the face has no surface.
+   */
+  [[nodiscard]] const GeomAdaptor_Surface& Surface(size_t row) const;
+
+  /**
+   * @return true if the face of the given row has a surface.
+   */
+  [[nodiscard]] bool HasSurface(size_t row) const;
+
+  /**
+   * @return The surface type of the given row. GeomAbs_OtherSurface if the
+   * face has no surface.
+   */
+  [[nodiscard]] GeomAbs_SurfaceType Type(size_t row) const;
+
+  /**
+   * @return The area of the given row, see surface::Area().
+   */
+  [[nodiscard]] double Area(size_t row) const;
+
+  /**
+   * @return The center of mass of the given row, see surface::CenterOfMass().
+   */
+  [[nodiscard]] gp_Pnt CenterOfMass(size_t row) const;
+
+  /**
+   * @return The U/V bounds (min, max) of the given row, see
+   * BRepTools::UVBounds().
+   */
+  [[nodiscard]] std::pair<gp_XY, gp_XY> UVBounds(size_t row) const;
+
+  /**
+   * @return The orientation of the face of the given row.
+   */
+  [[nodiscard]] TopAbs_Orientation Orientation(size_t row) const;
+
+  /**
+   * @return The columns, indexed by row.
+   */
+  [[nodiscard]] const std::vector<TopoDS_Face>&         Faces() const;
+  [[nodiscard]] const std::vector<GeomAbs_SurfaceType>& Types() const;
+  [[nodiscard]] const std::vector<double>&              Areas() const;
+
+  /**
+   * @return The rows whose surface is of the given type.
+   */
+  [[nodiscard]] std::vector<size_t> Only(GeomAbs_SurfaceType type) const;
+
+  /**
+   * @return The rows for which predicate(row) returns true.
+   */
+  template <typename Predicate>
+  [[nodiscard]] std::vector<size_t> Filter(const Predicate& predicate) const
+  {
+    std::vector<size_t> ret;
+    for (size_t row = 0; row < Size(); row++)
+    {
+      if (predicate(row))
+      {
+        ret.push_back(row);
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * @return The faces and surfaces of the given rows without surface-less
+   * faces, like surfaces::FromShape().
+   */
+  [[nodiscard]] std::vector<SurfaceInfo> SurfaceInfos(const std::vector<size_t>& rows) const;
+
+  /**
+   * @return The surface type statistics over all rows with a surface, like
+   * surfaces::Statistics().
+   */
+  [[nodiscard]] SurfaceTypeStats Statistics() const;
+
+private:
+  /**
+   * @brief Compute all properties of all rows in parallel.
+   */
+  void Build(size_t maxThreads);
+
+  /**
+   * @throws OCCInvalidArgumentException if the row is out of range.
+   */
+  void CheckRow(size_t row) const;
+
+  std::vector<TopoDS_Face>         m_faces;
+  std::vector<GeomAdaptor_Surface> m_surfaces;
+  std::vector<GeomAbs_SurfaceType> m_types;
+  std::vector<double>              m_areas;
+  std::vector<double>              m_centerX;
+  std::vector<double>              m_centerY;
+  std::vector<double>              m_centerZ;
+  std::vector<double>              m_uMin;
+  std::vector<double>              m_uMax;
+  std::vector<double>              m_vMin;
+  std::vector<double>              m_vMax;
+  std::vector<TopAbs_Orientation>  m_orientations;
+};
+
+} // namespace occutils::surfaces
@@ -8,6 +8,11 @@
 // OCC includes
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Dir.hxx>
+
+// occutils includes
+#include "occutils/occutils-surface-cache.h"
 
 namespace occutils::face
 {
@@ -72,4 +77,24 @@ std::optional<gp_Dir> NormalDirection(const TopoDS_Face& face,
                                       double             v         = 0.0,
                                       double             precision = 1e-6);
 
+/**
+ * Like Normal() above, but takes the surface of the face from the cache, so
+ * repeated queries on the same face do not look it up again.
+ */
+std::optional<gp_Ax1> Normal(const TopoDS_Face&     face,
+                             surface::AdaptorCache& cache,
+                             double                 u         = 0.0,
+                             double                 v         = 0.0,
+                             double                 precision = 1e-6);
+
+/**
+ * Like NormalDirection() above, but takes the surface of the face from the
+ * cache.
+ */
+std::optional<gp_Dir> NormalDirection(const TopoDS_Face&     face,
+                                      surface::AdaptorCache& cache,
+                                      double                 u         = 0.0,
+                                      double                 v         = 0.0,
+                                      double                 precision = 1e-6);
+
 } // namespace occutils::face
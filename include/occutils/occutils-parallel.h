@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * Utilities for running independent work items concurrently
+ */
+
+// std includes
+#include <cstddef>
+
+// OCC includes
+#include <OSD_ThreadPool.hxx>
+
+namespace occutils::parallel
+{
+
+/**
+ * Call functor(index) for every index in [begin, end), distributing the
+ * indices over the threads of the OCCT default thread pool.
+ *
+ * The calling thread takes part in the work and the call returns once every
+ * index has been processed. Nested calls from within a worker are safe: they
+ * only use the pool threads that are idle at that time.
+ *
+ * Exceptions should be handled inside the functor, as the thread pool
+ * converts any exception escaping a worker into a Standard_ProgramError.
+ *
+ * @param begin The first index to process
+ * @param end One past the last index to process
+ * @param functor Callable with the signature void(size_t index)
+ * @param maxThreads The maximum number of threads to use (including the
+ * calling thread). 0 uses all threads of the pool, 1 runs sequentially in the
+ * calling thread.
+ */
+template <typename Functor>
+void For(size_t begin, size_t end, const Functor& functor, size_t maxThreads = 0)
+{
+  if (begin >= end)
+  {
+    return;
+  }
+  if (maxThreads == 1 || end - begin == 1)
+  {
+    for (size_t index = begin; index < end; index++)
+    {
+      functor(index);
+    }
+    return;
+  }
+  OSD_ThreadPool::Launcher launcher(*OSD_ThreadPool::DefaultPool(),
+                                    maxThreads == 0 ? -1 : static_cast<int>(maxThreads));
+  launcher.Perform(static_cast<int>(begin),
+                   static_cast<int>(end),
+                   [&functor](int /* threadIndex */, int index)
+                   { functor(static_cast<size_t>(index)); });
+}
+
+} // namespace occutils::parallel
@@ -17,6 +17,10 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 
+// occutils includes
+#include "occutils/occutils-shape-range.h"
+#include "occutils/occutils-topology-index.h"
+
 namespace occutils::shape_components
 {
 
@@ -25,100 +29,190 @@ namespace occutils::shape_components
  * sub-shapes of type [type] it contains.
  *
  * NOTE: shape itself will NOT count, even if it is of type [type]
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are counted only once.
  */
-size_t CountX(const TopoDS_Shape& shape, TopAbs_ShapeEnum type);
-size_t CountX(const std::vector<TopoDS_Shape>& shapes, TopAbs_ShapeEnum type);
+size_t CountX(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, bool unique = false);
+size_t CountX(const std::vector<TopoDS_Shape>& shapes, TopAbs_ShapeEnum type, bool unique = false);
 size_t CountSolids(const TopoDS_Shape& shape, TopAbs_ShapeEnum type);
 
+/**
+ * Count the distinct sub-shapes of type [type] in a prebuilt index.
+ * Unlike the explorer based overloads, shared sub-shapes count once.
+ */
+size_t CountX(const TopologyIndex& index, TopAbs_ShapeEnum type);
+
 //------------------------------------------------------------------------------
 
 /**
  * Get all solids in a given shape
  * (not including the shape itself, if it is a solid)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Solid> AllSolidsWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Solid> AllSolidsWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all solids in the given shapes
  * (not including the shapes itself, if it is a solid)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Solid> AllSolidsWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Solid> AllSolidsWithin(const std::vector<TopoDS_Shape>& shapes,
+                                          bool                             unique = false);
+
+/**
+ * Get all distinct solids of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is a solid)
+ */
+std::vector<TopoDS_Solid> AllSolidsWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
 /**
  * Get all shells in a given shape
  * (not including the shape itself, if it is a shell)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Shell> AllShellsWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Shell> AllShellsWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all shells in the given shapes
  * (not including the shapes itself, if it is a shell)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
+ */
+std::vector<TopoDS_Shell> AllShellsWithin(const std::vector<TopoDS_Shape>& shapes,
+                                          bool                             unique = false);
+
+/**
+ * Get all distinct shells of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is a shell)
  */
-std::vector<TopoDS_Shell> AllShellsWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Shell> AllShellsWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
 /**
  * Get all faces in a given shape
  * (not including the shape itself, if it is a face)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Face> AllFacesWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Face> AllFacesWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all faces in the given shapes
  * (not including the shapes itself, if it is a face)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
+ */
+std::vector<TopoDS_Face> AllFacesWithin(const std::vector<TopoDS_Shape>& shapes,
+                                        bool                             unique = false);
+
+/**
+ * Get all distinct faces of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is a face)
  */
-std::vector<TopoDS_Face> AllFacesWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Face> AllFacesWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
 /**
  * Get all edges in a given shape
  * (not including the shape itself, if it is an edge)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Edge> AllEdgesWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Edge> AllEdgesWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all edges in the given shapes
  * (not including the shapes itself, if it is a edge)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Shape>& shapes,
+                                        bool                             unique = false);
 
 /**
  * Get all edges in the given shapes
  * (not including the shapes itself, if it is a edge)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
+ */
+std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Wire>& wires, bool unique = false);
+
+/**
+ * Get all distinct edges of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is an edge)
  */
-std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Wire>& wires);
+std::vector<TopoDS_Edge> AllEdgesWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
 /**
  * Get all wires in a given shape
  * (not including the shape itself, if it is a wire)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Wire> AllWiresWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Wire> AllWiresWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all wires in the given shapes
  * (not including the shapes itself, if it is a wire)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Wire> AllWiresWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Wire> AllWiresWithin(const std::vector<TopoDS_Shape>& shapes,
+                                        bool                             unique = false);
+
+/**
+ * Get all distinct wires of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is a wire)
+ */
+std::vector<TopoDS_Wire> AllWiresWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
 /**
  * Get all vertices in a given shape
  * (not including the shape itself, if it is a vertex)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Vertex> AllVerticesWithin(const TopoDS_Shape& shape);
+std::vector<TopoDS_Vertex> AllVerticesWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all vertices in the given shapes
  * (not including the shapes itself, if it is a vertex)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& shapes,
+                                             bool                             unique = false);
+
+/**
+ * Get all distinct vertices of a prebuilt index, in first-seen order
+ * (including the indexed shape itself, if it is a vertex)
+ */
+std::vector<TopoDS_Vertex> AllVerticesWithin(const TopologyIndex& index);
 
 //------------------------------------------------------------------------------
 
@@ -126,15 +220,55 @@ std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& sh
  * Get all vertex coordinates in a given shape.
  * Like AllVerticesWithin() but converts the TopoDS_Vertex instances
  * to gp_Pnts (not including the shape itself, if it is a vertex)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopoDS_Shape& shape);
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopoDS_Shape& shape, bool unique = false);
 
 /**
  * Get all vertices coordinates in the given shapes.
  * Like AllVerticesWithin() but converts the TopoDS_Vertex instances
  * to gp_Pnts (not including the shape itself, if it is a vertex)
+ *
+ * If [unique] is true, sub-shapes shared by several parents (see
+ * TopoDS_Shape::IsSame()) are returned only once, in first-seen order.
  */
-std::vector<gp_Pnt> AllVertexCoordinatesWithin(const std::vector<TopoDS_Shape>& shapes);
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const std::vector<TopoDS_Shape>& shapes,
+                                               bool                             unique = false);
+
+/**
+ * Get the coordinates of all distinct vertices of a prebuilt index, in
+ * first-seen order.
+ */
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopologyIndex& index);
+
+//------------------------------------------------------------------------------
+
+/**
+ * Parallel variants of the std::vector<TopoDS_Shape> overloads, for many
+ * shapes such as the parts of a large assembly.
+ *
+ * The sub-shapes of every shape are counted first, then every shape fills its
+ * own slice of a preallocated result concurrently. The result is identical to
+ * the sequential overload (with unique == false), including the order.
+ *
+ * @param maxThreads The maximum number of threads to use (including the
+ * calling thread). 0 uses all threads of the pool.
+ */
+std::vector<TopoDS_Face> AllFacesWithinParallel(const std::vector<TopoDS_Shape>& shapes,
+                                                size_t                           maxThreads = 0);
+
+std::vector<TopoDS_Edge> AllEdgesWithinParallel(const std::vector<TopoDS_Shape>& shapes,
+                                                size_t                           maxThreads = 0);
+
+std::vector<gp_Pnt> AllVertexCoordinatesWithinParallel(
+  const std::vector<TopoDS_Shape>& shapes,
+  size_t                           maxThreads = 0);
+
+size_t CountXParallel(const std::vector<TopoDS_Shape>& shapes,
+                      TopAbs_ShapeEnum                 type,
+                      size_t                           maxThreads = 0);
 
 //------------------------------------------------------------------------------
 
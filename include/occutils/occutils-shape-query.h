@@ -0,0 +1,164 @@
+#pragma once
+
+/**
+ * Predicate queries over the sub-shapes of a shape, which stop exploring as
+ * soon as the answer is known.
+ *
+ * Every query comes in two flavours:
+ *  - typed templates, e.g. Any<TopoDS_Face>(shape, predicate), which take the
+ *    predicate as a template parameter so lambdas are inlined
+ *  - runtime variants taking a TopAbs_ShapeEnum and a std::function
+ *
+ * Like TopExp_Explorer (and AllFacesWithin() & co.), sub-shapes shared by
+ * several parents are visited once per parent, and the shape itself is
+ * visited if it is of the requested type.
+ */
+
+// std includes
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// OCC includes
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-shape-range.h"
+
+namespace occutils::shape_components
+{
+
+/**
+ * @return true if any sub-shape of type T within [shape] satisfies the
+ * predicate. Stops at the first hit.
+ *
+ * Usage example:
+ * @code
+ * bool hasBSpline = shape_components::Any<TopoDS_Face>(
+ *   shape,
+ *   [](const TopoDS_Face& face) { return surface::IsBSplineSurface(surface::FromFace(face)); });
+ * @endcode
+ */
+template <typename T, typename Predicate>
+bool Any(const TopoDS_Shape& shape, const Predicate& predicate)
+{
+  for (const T& subShape : SubShapeRange<T>(shape))
+  {
+    if (predicate(subShape))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @return The first sub-shape of type T within [shape] that satisfies the
+ * predicate, or no value.
+ */
+template <typename T, typename Predicate>
+std::optional<T> FindFirst(const TopoDS_Shape& shape, const Predicate& predicate)
+{
+  for (const T& subShape : SubShapeRange<T>(shape))
+  {
+    if (predicate(subShape))
+    {
+      return subShape;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * @return true if at most [maxCount] sub-shapes of type T within [shape]
+ * satisfy the predicate. Stops at hit maxCount + 1.
+ */
+template <typename T, typename Predicate>
+bool CountAtMost(const TopoDS_Shape& shape, size_t maxCount, const Predicate& predicate)
+{
+  size_t count = 0;
+  for (const T& subShape : SubShapeRange<T>(shape))
+  {
+    if (predicate(subShape) && ++count > maxCount)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @return true if [shape] contains at most [maxCount] sub-shapes of type T.
+ * Stops at sub-shape maxCount + 1.
+ */
+template <typename T>
+bool CountAtMost(const TopoDS_Shape& shape, size_t maxCount)
+{
+  return CountAtMost<T>(shape, maxCount, [](const T& /* subShape */) { return true; });
+}
+
+/**
+ * Split the sub-shapes of type T within [shape] by a predicate. This needs a
+ * full traversal.
+ *
+ * @return The sub-shapes satisfying the predicate (first) and the others
+ * (second), both in explorer order.
+ */
+template <typename T, typename Predicate>
+std::pair<std::vector<T>, std::vector<T>> Partition(const TopoDS_Shape& shape,
+                                                    const Predicate&    predicate)
+{
+  auto ret = std::make_pair(std::vector<T>(), std::vector<T>());
+  for (const T& subShape : SubShapeRange<T>(shape))
+  {
+    (predicate(subShape) ? ret.first : ret.second).push_back(subShape);
+  }
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
+/**
+ * Predicate of the runtime queries.
+ */
+using ShapePredicate = std::function<bool(const TopoDS_Shape&)>;
+
+/**
+ * @return true if any sub-shape of type [type] within [shape] satisfies the
+ * predicate. Stops at the first hit.
+ */
+bool Any(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, const ShapePredicate& predicate);
+
+/**
+ * @return The first sub-shape of type [type] within [shape] that satisfies
+ * the predicate, or no value.
+ */
+std::optional<TopoDS_Shape> FindFirst(const TopoDS_Shape&   shape,
+                                      TopAbs_ShapeEnum      type,
+                                      const ShapePredicate& predicate);
+
+/**
+ * @return true if at most [maxCount] sub-shapes of type [type] within [shape]
+ * satisfy the predicate. An empty predicate accepts every sub-shape. Stops at
+ * hit maxCount + 1.
+ */
+bool CountAtMost(const TopoDS_Shape&   shape,
+                 TopAbs_ShapeEnum      type,
+                 size_t                maxCount,
+                 const ShapePredicate& predicate = ShapePredicate());
+
+/**
+ * Split the sub-shapes of type [type] within [shape] by a predicate.
+ *
+ * @return The sub-shapes satisfying the predicate (first) and the others
+ * (second), both in explorer order.
+ */
+std::pair<std::vector<TopoDS_Shape>, std::vector<TopoDS_Shape>> Partition(
+  const TopoDS_Shape&   shape,
+  TopAbs_ShapeEnum      type,
+  const ShapePredicate& predicate);
+
+} // namespace occutils::shape_components
@@ -0,0 +1,310 @@
+#pragma once
+
+/**
+ * Lazy views over the sub-shapes of a shape.
+ */
+
+// std includes
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// OCC includes
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+
+namespace occutils::shape_components
+{
+
+/**
+ * Maps a TopoDS sub-shape class to its TopAbs_ShapeEnum type.
+ */
+template <typename T>
+struct SubShapeTraits;
+
+template <>
+struct SubShapeTraits<TopoDS_Solid>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_SOLID;
+  static const TopoDS_Solid&        Cast(const TopoDS_Shape& shape) { return TopoDS::Solid(shape); }
+};
+
+template <>
+struct SubShapeTraits<TopoDS_Shell>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_SHELL;
+  static const TopoDS_Shell&        Cast(const TopoDS_Shape& shape) { return TopoDS::Shell(shape); }
+};
+
+template <>
+struct SubShapeTraits<TopoDS_Face>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_FACE;
+  static const TopoDS_Face&         Cast(const TopoDS_Shape& shape) { return TopoDS::Face(shape); }
+};
+
+template <>
+struct SubShapeTraits<TopoDS_Wire>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_WIRE;
+  static const TopoDS_Wire&         Cast(const TopoDS_Shape& shape) { return TopoDS::Wire(shape); }
+};
+
+template <>
+struct SubShapeTraits<TopoDS_Edge>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_EDGE;
+  static const TopoDS_Edge&         Cast(const TopoDS_Shape& shape) { return TopoDS::Edge(shape); }
+};
+
+template <>
+struct SubShapeTraits<TopoDS_Vertex>
+{
+  static constexpr TopAbs_ShapeEnum Type = TopAbs_VERTEX;
+  static const TopoDS_Vertex& Cast(const TopoDS_Shape& shape) { return TopoDS::Vertex(shape); }
+};
+
+/**
+ * @class SubShapeRange
+ * @brief Lazy view over all sub-shapes of type T of a shape.
+ *
+ * The sub-shapes are produced by a TopExp_Explorer while iterating, in the
+ * same order (and with the same duplicates) as AllSolidsWithin() & co., but
+ * without collecting them into a vector first. Stopping early skips the rest
+ * of the traversal.
+ *
+ * TopExp_Explorer cannot be copied, so the range owns it and its iterators
+ * are single-pass input iterators. Calling begin() again restarts the
+ * traversal. A range must not be iterated by several threads at once.
+ *
+ * Usage example:
+ * @code
+ * for (const TopoDS_Face& face : shape_components::Faces(shape))
+ * {
+ *   ...
+ * }
+ * @endcode
+ */
+template <typename T>
+class SubShapeRange
+{
+public:
+  class Iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    Iterator() = default;
+
+    explicit Iterator(TopExp_Explorer* explorer) : m_explorer(explorer) {}
+
+    reference operator*() const { return SubShapeTraits<T>::Cast(m_explorer->Current()); }
+
+    pointer operator->() const { return &**this; }
+
+    Iterator& operator++()
+    {
+      m_explorer->Next();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(const Iterator& other) const { return AtEnd() == other.AtEnd(); }
+
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+  private:
+    [[nodiscard]] bool AtEnd() const { return m_explorer == nullptr || !m_explorer->More(); }
+
+    TopExp_Explorer* m_explorer = nullptr;
+  };
+
+  /**
+   * @param shape The shape to explore. A null shape yields an empty range.
+   */
+  explicit SubShapeRange(const TopoDS_Shape& shape) : m_shape(shape) {}
+
+  SubShapeRange(const SubShapeRange& other) : m_shape(other.m_shape) {}
+
+  SubShapeRange& operator=(const SubShapeRange& other)
+  {
+    m_shape = other.m_shape;
+    m_explorer.Clear();
+    return *this;
+  }
+
+  /**
+   * @brief Starts (or restarts) the traversal.
+   */
+  Iterator begin() const
+  {
+    if (m_shape.IsNull())
+    {
+      return end();
+    }
+    m_explorer.Init(m_shape, SubShapeTraits<T>::Type);
+    return Iterator(&m_explorer);
+  }
+
+  Iterator end() const { return Iterator(); }
+
+  /**
+   * @return true if the shape has no sub-shape of type T. Only explores up
+   * to the first hit.
+   */
+  [[nodiscard]] bool IsEmpty() const { return begin() == end(); }
+
+private:
+  TopoDS_Shape            m_shape;
+  mutable TopExp_Explorer m_explorer;
+};
+
+/**
+ * @class FilteredRange
+ * @brief Lazy view over the elements of another range that satisfy a
+ * predicate. Create it using Filter().
+ */
+template <typename Range, typename Predicate>
+class FilteredRange
+{
+public:
+  using BaseIterator = decltype(std::declval<const Range&>().begin());
+
+  class Iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = typename std::iterator_traits<BaseIterator>::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = typename std::iterator_traits<BaseIterator>::pointer;
+    using reference         = typename std::iterator_traits<BaseIterator>::reference;
+
+    Iterator(BaseIterator it, BaseIterator end, const Predicate* predicate)
+        : m_it(std::move(it)),
+          m_end(std::move(end)),
+          m_predicate(predicate)
+    {
+      SkipRejected();
+    }
+
+    reference operator*() const { return *m_it; }
+
+    pointer operator->() const { return &*m_it; }
+
+    Iterator& operator++()
+    {
+      ++m_it;
+      SkipRejected();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+  private:
+    void SkipRejected()
+    {
+      while (m_it != m_end && !(*m_predicate)(*m_it))
+      {
+        ++m_it;
+      }
+    }
+
+    BaseIterator     m_it;
+    BaseIterator     m_end;
+    const Predicate* m_predicate;
+  };
+
+  FilteredRange(Range range, Predicate predicate)
+      : m_range(std::move(range)),
+        m_predicate(std::move(predicate))
+  {
+  }
+
+  Iterator begin() const { return Iterator(m_range.begin(), m_range.end(), &m_predicate); }
+
+  Iterator end() const { return Iterator(m_range.end(), m_range.end(), &m_predicate); }
+
+  /**
+   * @return true if no element satisfies the predicate. Only iterates up to
+   * the first hit.
+   */
+  [[nodiscard]] bool IsEmpty() const { return begin() == end(); }
+
+private:
+  Range     m_range;
+  Predicate m_predicate;
+};
+
+/**
+ * Lazily filter a range, e.g. a SubShapeRange or another FilteredRange.
+ * Filters compose by nesting:
+ *
+ * @code
+ * auto planar = shape_components::Filter(shape_components::Faces(shape),
+ *                                        [](const TopoDS_Face& face)
+ *                                        { return surface::IsPlane(surface::FromFace(face)); });
+ * @endcode
+ *
+ * @param range The range to filter. It is copied into the filtered range.
+ * @param predicate Callable with the signature bool(const T&)
+ */
+template <typename Range, typename Predicate>
+FilteredRange<Range, Predicate> Filter(Range range, Predicate predicate)
+{
+  return FilteredRange<Range, Predicate>(std::move(range), std::move(predicate));
+}
+
+//------------------------------------------------------------------------------
+
+/**
+ * Lazy views over all sub-shapes of the given type within [shape]
+ * (including the shape itself, if it is of that type).
+ */
+inline SubShapeRange<TopoDS_Solid> Solids(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Solid>(shape);
+}
+
+inline SubShapeRange<TopoDS_Shell> Shells(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Shell>(shape);
+}
+
+inline SubShapeRange<TopoDS_Face> Faces(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Face>(shape);
+}
+
+inline SubShapeRange<TopoDS_Wire> Wires(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Wire>(shape);
+}
+
+inline SubShapeRange<TopoDS_Edge> Edges(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Edge>(shape);
+}
+
+inline SubShapeRange<TopoDS_Vertex> Vertices(const TopoDS_Shape& shape)
+{
+  return SubShapeRange<TopoDS_Vertex>(shape);
+}
+
+} // namespace occutils::shape_components
@@ -0,0 +1,95 @@
+#pragma once
+
+// std includes
+#include <vector>
+
+// OCC includes
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Wire.hxx>
+#include <gp_Ax1.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean.h"
+
+namespace occutils::slicer
+{
+
+/**
+ * A single slice of a shape
+ */
+struct Layer
+{
+  /**
+   * The position of the slicing plane along the slicing axis.
+   */
+  double height = 0.0;
+
+  /**
+   * The closed contours of the slice.
+   */
+  std::vector<TopoDS_Wire> wires;
+
+  /**
+   * The number of section edge chains that could not be closed, e.g. due to
+   * gaps in the input shape. They are not part of wires.
+   */
+  size_t openWires = 0;
+
+  /**
+   * True if the section of this layer failed.
+   */
+  bool failed = false;
+};
+
+/**
+ * Slice a shape with a stack of parallel planes, e.g. to compute the contours
+ * of an additive-manufacturing build job.
+ *
+ * Instead of sectioning the whole shape once per layer, every face is
+ * bucketed into the layers its extent along the axis spans, and each layer is
+ * sectioned only against the faces in its bucket. Layers are sectioned in
+ * parallel.
+ *
+ * @param shape The shape to slice.
+ * @param axis The slicing axis. The planes are perpendicular to it.
+ * @param heights The positions of the planes along the axis, measured from
+ * the axis location. Need not be sorted.
+ * @param options The options of the underlying boolean::Section calls.
+ * nonDestructive is always set, since faces spanning several layers are
+ * sectioned concurrently.
+ * @param maxThreads The maximum number of threads to use. 0 uses all
+ * available threads.
+ * @return One layer per height, sorted by ascending height. Layers that do
+ * not cut the shape have no wires.
+ *
+ * @throws OCCInvalidArgumentException if the shape is null.
+ */
+std::vector<Layer> Slice(const TopoDS_Shape&            shape,
+                         const gp_Ax1&                  axis,
+                         const std::vector<double>&     heights,
+                         const boolean::BooleanOptions& options    = boolean::DefaultOptions(),
+                         size_t                         maxThreads = 0);
+
+/**
+ * Slice a shape with equidistant parallel planes, see Slice().
+ *
+ * @param shape The shape to slice.
+ * @param axis The slicing axis. The planes are perpendicular to it.
+ * @param layerThickness The distance between two planes. The first plane is
+ * placed half a layer above the lowest point of the shape.
+ * @param options The options of the underlying boolean::Section calls.
+ * @param maxThreads The maximum number of threads to use. 0 uses all
+ * available threads.
+ * @return One layer per plane, sorted by ascending height.
+ *
+ * @throws OCCInvalidArgumentException if the shape is null or layerThickness
+ * is not positive.
+ */
+std::vector<Layer> SliceUniform(
+  const TopoDS_Shape&            shape,
+  const gp_Ax1&                  axis,
+  double                         layerThickness,
+  const boolean::BooleanOptions& options    = boolean::DefaultOptions(),
+  size_t                         maxThreads = 0);
+
+} // namespace occutils::slicer
@@ -0,0 +1,73 @@
+#pragma once
+
+// std includes
+#include <cstddef>
+
+// OCC includes
+#include <GeomAdaptor_Surface.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+// occutils includes
+#include "occutils/occutils-surface.h"
+
+namespace occutils::surface
+{
+
+/**
+ * @class AdaptorCache
+ * @brief Caches the surface adaptor of every face, keyed by TShape and
+ * location, so repeated queries on the same faces look up and build the
+ * adaptor only once.
+ *
+ * Reusing an adaptor also reuses its evaluation cache, e.g. the span cache
+ * of BSpline surfaces.
+ *
+ * Usage example:
+ * @code
+ * surface::AdaptorCache cache;
+ * for (const gp_XY& uv : uvs)
+ * {
+ *   auto normal = face::Normal(face, cache, uv.X(), uv.Y());
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe, as neither are the adaptors it hands out. Use one
+ * cache per thread.
+ */
+class AdaptorCache
+{
+public:
+  /**
+   * @param lookup How to find the surface of a face, see FromFace()
+   */
+  explicit AdaptorCache(SurfaceLookup lookup = SurfaceLookup::Stored);
+
+  AdaptorCache(const AdaptorCache&)            = delete;
+  AdaptorCache& operator=(const AdaptorCache&) = delete;
+
+  /**
+   * @return The adaptor of the face, see FromFace(). The reference stays
+   * valid until Clear().
+   */
+  const GeomAdaptor_Surface& Get(const TopoDS_Face& face);
+
+  /**
+   * @return The number of cached adaptors.
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * @brief Removes all cached adaptors.
+   */
+  void Clear();
+
+private:
+  SurfaceLookup m_lookup;
+
+  NCollection_DataMap<TopoDS_Shape, GeomAdaptor_Surface, TopTools_ShapeMapHasher> m_adaptors;
+};
+
+} // namespace occutils::surface
@@ -0,0 +1,141 @@
+#pragma once
+
+/**
+ * Batched evaluation of surfaces on U/V grids
+ */
+
+// std includes
+#include <cstddef>
+#include <vector>
+
+// OCC includes
+#include <GeomAdaptor_Surface.hxx>
+#include <TopoDS_Face.hxx>
+
+namespace occutils::surface
+{
+
+/**
+ * @brief A tensor product U/V grid: sample (i, j) is at (u[i], v[j]).
+ */
+struct UVGrid
+{
+  std::vector<double> u;
+  std::vector<double> v;
+
+  /**
+   * @return The number of samples.
+   */
+  [[nodiscard]] size_t Size() const { return u.size() * v.size(); }
+};
+
+/**
+ * @brief Points, normals and optionally first derivatives sampled on a grid,
+ * one contiguous array per coordinate.
+ *
+ * Sample (i, j) of a grid is stored at index i * grid.v.size() + j, i.e. in
+ * the order of UniformUVSampleLocations().
+ */
+struct GridSamples
+{
+  /**
+   * @brief The points on the surface.
+   */
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+
+  /**
+   * @brief The unit normals of the surface, not accounting for the face
+   * orientation (like face::Normal()). Zero where the normal is undefined.
+   */
+  std::vector<double> nx;
+  std::vector<double> ny;
+  std::vector<double> nz;
+
+  /**
+   * @brief If requested, the first derivatives along U and V. Empty otherwise.
+   */
+  std::vector<double> dux;
+  std::vector<double> duy;
+  std::vector<double> duz;
+  std::vector<double> dvx;
+  std::vector<double> dvy;
+  std::vector<double> dvz;
+
+  /**
+   * @return The number of samples.
+   */
+  [[nodiscard]] size_t Size() const { return x.size(); }
+};
+
+/**
+ * Create a uniformly spaced grid of uSamples x vSamples parameters between
+ * the first and last U/V parameters of the surface (both included).
+ */
+UVGrid UniformUVGrid(const GeomAdaptor_Surface& surf,
+                     size_t                     uSamples = 10,
+                     size_t                     vSamples = 10);
+
+/**
+ * Create a uniformly spaced grid of uSamples x vSamples parameters between
+ * the U/V bounds of the face (both included), which unlike the parameter
+ * range of its surface are finite, e.g. for planar faces.
+ */
+UVGrid UniformUVGrid(const TopoDS_Face& face, size_t uSamples = 10, size_t vSamples = 10);
+
+/**
+ * @brief Evaluate a surface on a grid.
+ *
+ * Every sample is evaluated through the same adaptor, so BSpline surfaces
+ * reuse its span cache from one sample to the next. Normals come from the
+ * cross product of the first derivatives. Only at singular points, e.g. the
+ * poles of a sphere, they are computed by GeomLProp_SLProps.
+ *
+ * @param surf The surface
+ * @param grid The U/V parameters
+ * @param withDerivatives Whether to fill the first derivatives
+ * @param precision Below this magnitude, the cross product of the first
+ * derivatives is treated as zero (see surface::Normal()).
+ */
+GridSamples EvaluateGrid(const GeomAdaptor_Surface& surf,
+                         const UVGrid&              grid,
+                         bool                       withDerivatives = false,
+                         double                     precision       = 1e-6);
+
+/**
+ * @brief Evaluate the surface of a face on a grid, see above.
+ *
+ * @return The samples, empty if the face has no surface.
+ */
+GridSamples EvaluateGrid(const TopoDS_Face& face,
+                         const UVGrid&      grid,
+                         bool               withDerivatives = false,
+                         double             precision       = 1e-6);
+
+/**
+ * @brief Evaluate many faces on their UniformUVGrid() in parallel.
+ *
+ * Usage example:
+ * @code
+ * auto faces   = shape_components::AllFacesWithin(shape);
+ * auto samples = surface::EvaluateGrids(faces, 8, 8);
+ * // The normal of sample k of face i is (nx, ny, nz)[i * 64 + k]
+ * @endcode
+ *
+ * @param faces The faces
+ * @param uSamples The number of U parameters per face
+ * @param vSamples The number of V parameters per face
+ * @param withDerivatives Whether to fill the first derivatives
+ * @param maxThreads The maximum number of threads to use (including the
+ * calling thread). 0 uses all threads of the pool.
+ * @return The samples of face i at [i * uSamples * vSamples, (i + 1) *
+ * uSamples * vSamples). Samples of faces without surface are NaN.
+ */
+GridSamples EvaluateGrids(const std::vector<TopoDS_Face>& faces,
+                          size_t                          uSamples        = 10,
+                          size_t                          vSamples        = 10,
+                          bool                            withDerivatives = false,
+                          size_t                          maxThreads      = 0);
+
+} // namespace occutils::surface
@@ -39,10 +39,30 @@ double Area(const TopoDS_Shape& face);
 gp_Pnt CenterOfMass(const TopoDS_Shape& face);
 
 /**
- * Get the 3D surface from a given face
+ * How FromFace() finds the surface of a face.
+ */
+enum class SurfaceLookup
+{
+  /**
+   * Use the surface stored in the face (BRep_Tool::Surface()) and only search
+   * with BRepLib_FindSurface if there is none, e.g. for mesh-only faces.
+   */
+  Stored,
+
+  /**
+   * Always search with BRepLib_FindSurface.
+   */
+  Search
+};
+
+/**
+ * Get the 3D surface from a given face, placed at the location of the face.
  * If no surface can be found, returnValue.Surface().IsNull() == true
+ *
+ * To query the same faces repeatedly, use a surface::AdaptorCache.
  */
-GeomAdaptor_Surface FromFace(const TopoDS_Face& face);
+GeomAdaptor_Surface FromFace(const TopoDS_Face& face,
+                             SurfaceLookup      lookup = SurfaceLookup::Stored);
 
 /**
  * Get both the area and the center of mass of a surface.
@@ -0,0 +1,116 @@
+#pragma once
+
+// std includes
+#include <array>
+#include <optional>
+#include <vector>
+
+// OCC includes
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+
+namespace occutils::shape_components
+{
+
+/**
+ * @class TopologyIndex
+ * @brief All sub-shapes of a shape, collected in a single traversal.
+ *
+ * The index holds one deduplicated array per sub-shape type. Two occurrences
+ * of a sub-shape are the same if they share the same TShape and location
+ * (TopoDS_Shape::IsSame()), so an edge shared by two faces is stored once.
+ * Every sub-shape gets a stable ID, its position in the array of its type, in
+ * the order the sub-shapes are first met by a TopExp_Explorer. Subtrees of
+ * sub-shapes that were already visited are skipped, so building the index is
+ * cheaper than a single explorer pass over a type.
+ *
+ * Like TopExp_Explorer, the index includes the shape itself.
+ *
+ * Usage example:
+ * @code
+ * shape_components::TopologyIndex index(shape);
+ * for (const TopoDS_Face& face : index.Faces())
+ * {
+ *   ...
+ * }
+ * size_t edgeCount = index.Count(TopAbs_EDGE);
+ * @endcode
+ */
+class TopologyIndex
+{
+public:
+  /**
+   * @brief Builds the index of the given shape.
+   *
+   * @param shape The shape to index. A null shape yields an empty index.
+   */
+  explicit TopologyIndex(const TopoDS_Shape& shape);
+
+  /**
+   * @return The indexed shape.
+   */
+  [[nodiscard]] const TopoDS_Shape& Shape() const;
+
+  /**
+   * @return The number of distinct sub-shapes of the given type.
+   */
+  [[nodiscard]] size_t Count(TopAbs_ShapeEnum type) const;
+
+  /**
+   * @return The sub-shape of the given type with the given ID.
+   *
+   * @throws OCCInvalidArgumentException if the ID is out of range.
+   */
+  [[nodiscard]] const TopoDS_Shape& Get(TopAbs_ShapeEnum type, size_t id) const;
+
+  /**
+   * @return The ID of the given sub-shape, or no value if it is not part of
+   * the indexed shape.
+   */
+  [[nodiscard]] std::optional<size_t> IdOf(const TopoDS_Shape& subShape) const;
+
+  /**
+   * @return The map of all distinct sub-shapes of the given type. The map
+   * index of a sub-shape is its ID + 1.
+   */
+  [[nodiscard]] const TopTools_IndexedMapOfShape& Map(TopAbs_ShapeEnum type) const;
+
+  [[nodiscard]] const std::vector<TopoDS_Solid>&  Solids() const;
+  [[nodiscard]] const std::vector<TopoDS_Shell>&  Shells() const;
+  [[nodiscard]] const std::vector<TopoDS_Face>&   Faces() const;
+  [[nodiscard]] const std::vector<TopoDS_Wire>&   Wires() const;
+  [[nodiscard]] const std::vector<TopoDS_Edge>&   Edges() const;
+  [[nodiscard]] const std::vector<TopoDS_Vertex>& Vertices() const;
+
+private:
+  /**
+   * @brief Adds the shape and, if it was not visited before, its subtree.
+   */
+  void Visit(const TopoDS_Shape& shape);
+
+  /**
+   * @brief The indexed shape.
+   */
+  TopoDS_Shape m_shape;
+
+  /**
+   * @brief One map per TopAbs_ShapeEnum value (except TopAbs_SHAPE).
+   */
+  std::array<TopTools_IndexedMapOfShape, TopAbs_SHAPE> m_maps;
+
+  std::vector<TopoDS_Solid>  m_solids;
+  std::vector<TopoDS_Shell>  m_shells;
+  std::vector<TopoDS_Face>   m_faces;
+  std::vector<TopoDS_Wire>   m_wires;
+  std::vector<TopoDS_Edge>   m_edges;
+  std::vector<TopoDS_Vertex> m_vertices;
+};
+
+} // namespace occutils::shape_components
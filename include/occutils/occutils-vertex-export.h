@@ -0,0 +1,112 @@
+#pragma once
+
+/**
+ * Export of vertex coordinates into flat arrays for numeric code and viewers.
+ */
+
+// std includes
+#include <cstddef>
+#include <vector>
+
+// occutils includes
+#include "occutils/occutils-topology-index.h"
+
+namespace occutils::shape_components
+{
+
+/**
+ * Memory layout of exported coordinates.
+ */
+enum class CoordinateLayout
+{
+  Separate,   //!< One array each for x, y and z (structure of arrays)
+  Interleaved //!< One array x0 y0 z0 x1 y1 z1 ...
+};
+
+/**
+ * @brief Vertex coordinates owned by the caller of ExportVertexCoordinates().
+ */
+struct VertexCoordinateArrays
+{
+  /**
+   * @brief The point coordinates, if the layout is CoordinateLayout::Separate.
+   */
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+
+  /**
+   * @brief The point coordinates, if the layout is
+   * CoordinateLayout::Interleaved.
+   */
+  std::vector<double> xyz;
+
+  /**
+   * @brief If requested, the point of every vertex:
+   * pointOfVertex[vertexId] is the index of the point of that vertex.
+   */
+  std::vector<int> pointOfVertex;
+
+  /**
+   * @return The number of exported points.
+   */
+  [[nodiscard]] size_t Size() const { return x.empty() ? xyz.size() / 3 : x.size(); }
+};
+
+/**
+ * Export the coordinates of the distinct vertices of an index.
+ *
+ * Without merging, point i is the vertex with ID i. With a positive
+ * [mergeTolerance], vertices closer than the tolerance to an earlier point
+ * (e.g. coincident vertices of unsewn faces) share that point, and points
+ * keep the order of the first vertex merged into them.
+ *
+ * @param index The index providing the vertices and their IDs
+ * @param layout The layout of the coordinate arrays
+ * @param withVertexMap Whether to fill VertexCoordinateArrays::pointOfVertex
+ * @param mergeTolerance The distance below which vertices are merged. 0 only
+ * merges vertices that are the same (see TopoDS_Shape::IsSame()).
+ */
+VertexCoordinateArrays ExportVertexCoordinates(
+  const TopologyIndex& index,
+  CoordinateLayout     layout         = CoordinateLayout::Separate,
+  bool                 withVertexMap  = false,
+  double               mergeTolerance = 0.0);
+
+/**
+ * Like ExportVertexCoordinates() above, but write into caller-provided
+ * buffers, one array each for x, y and z.
+ *
+ * Every buffer must hold at least index.Count(TopAbs_VERTEX) values, the
+ * number of points before merging.
+ *
+ * @param pointOfVertex If not null, receives the point of every vertex ID
+ *
+ * @return The number of points written.
+ *
+ * @throws OCCInvalidArgumentException if a coordinate buffer is null while
+ * the index has vertices.
+ */
+size_t ExportVertexCoordinates(const TopologyIndex& index,
+                               double*              x,
+                               double*              y,
+                               double*              z,
+                               int*                 pointOfVertex  = nullptr,
+                               double               mergeTolerance = 0.0);
+
+/**
+ * Like ExportVertexCoordinates() above, but write into a single
+ * caller-provided buffer x0 y0 z0 x1 y1 z1 ... which must hold at least
+ * 3 * index.Count(TopAbs_VERTEX) values.
+ *
+ * @return The number of points written.
+ *
+ * @throws OCCInvalidArgumentException if the buffer is null while the index
+ * has vertices.
+ */
+size_t ExportVertexCoordinatesInterleaved(const TopologyIndex& index,
+                                          double*              xyz,
+                                          int*                 pointOfVertex  = nullptr,
+                                          double               mergeTolerance = 0.0);
+
+} // namespace occutils::shape_components
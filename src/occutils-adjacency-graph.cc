@@ -0,0 +1,251 @@
+#include "occutils/occutils-adjacency-graph.h"
+
+// OCC includes
+#include <BRep_Tool.hxx>
+#include <ChFi3d.hxx>
+#include <ChFiDS_TypeOfConcavity.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Vertex.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::shape_components
+{
+
+namespace
+{
+
+/**
+ * Append value to the last row of a CSR relation unless the row already
+ * contains it. Rows are short, so a linear scan is fine.
+ */
+void AppendUnique(const std::vector<int>& offsets, std::vector<int>& values, int value)
+{
+  for (size_t i = static_cast<size_t>(offsets.back()); i < values.size(); i++)
+  {
+    if (values[i] == value)
+    {
+      return;
+    }
+  }
+  values.push_back(value);
+}
+
+/**
+ * Classify the connection of two faces along their shared edge.
+ */
+Convexity ClassifyEdge(const TopoDS_Edge& edge, const TopoDS_Face& face1, const TopoDS_Face& face2)
+{
+  if (BRep_Tool::Degenerated(edge))
+  {
+    return Convexity::Unknown;
+  }
+  try
+  {
+    switch (ChFi3d::DefineConnectType(edge, face1, face2, Precision::Angular(), false))
+    {
+      case ChFiDS_Convex:
+        return Convexity::Convex;
+      case ChFiDS_Concave:
+        return Convexity::Concave;
+      case ChFiDS_Tangential:
+        return Convexity::Smooth;
+      default:
+        return Convexity::Unknown;
+    }
+  }
+  catch (const Standard_Failure&)
+  {
+    // Must not escape a worker of the thread pool
+    return Convexity::Unknown;
+  }
+}
+
+} // namespace
+
+AdjacencyGraph::AdjacencyGraph(const TopologyIndex& index, bool classifyConvexity)
+{
+  const int faceCount = static_cast<int>(index.Count(TopAbs_FACE));
+  const int edgeCount = static_cast<int>(index.Count(TopAbs_EDGE));
+  m_vertexCount       = static_cast<int>(index.Count(TopAbs_VERTEX));
+
+  const TopTools_IndexedMapOfShape& edgeMap   = index.Map(TopAbs_EDGE);
+  const TopTools_IndexedMapOfShape& vertexMap = index.Map(TopAbs_VERTEX);
+
+  // Face -> edges
+  m_faceEdgeOffsets.reserve(faceCount + 1);
+  m_faceEdgeOffsets.push_back(0);
+  for (const TopoDS_Face& face : index.Faces())
+  {
+    for (TopExp_Explorer edgeExplorer(face, TopAbs_EDGE); edgeExplorer.More(); edgeExplorer.Next())
+    {
+      AppendUnique(m_faceEdgeOffsets, m_faceEdges, edgeMap.FindIndex(edgeExplorer.Current()) - 1);
+    }
+    m_faceEdgeOffsets.push_back(static_cast<int>(m_faceEdges.size()));
+  }
+
+  // Edge -> faces, by transposing face -> edges. Filling the rows face by
+  // face keeps them sorted.
+  m_edgeFaceOffsets.assign(edgeCount + 1, 0);
+  for (const int edge : m_faceEdges)
+  {
+    m_edgeFaceOffsets[edge + 1]++;
+  }
+  for (int edge = 0; edge < edgeCount; edge++)
+  {
+    m_edgeFaceOffsets[edge + 1] += m_edgeFaceOffsets[edge];
+  }
+  m_edgeFaces.resize(m_faceEdges.size());
+  std::vector<int> fill(m_edgeFaceOffsets.begin(), m_edgeFaceOffsets.end() - 1);
+  for (int face = 0; face < faceCount; face++)
+  {
+    for (const int edge : FaceEdges(face))
+    {
+      m_edgeFaces[fill[edge]++] = face;
+    }
+  }
+
+  // Edge -> vertices
+  m_edgeVertexOffsets.reserve(edgeCount + 1);
+  m_edgeVertexOffsets.push_back(0);
+  for (const TopoDS_Edge& edge : index.Edges())
+  {
+    TopoDS_Vertex first, last;
+    TopExp::Vertices(edge, first, last);
+    for (const TopoDS_Vertex& vertex : {first, last})
+    {
+      if (!vertex.IsNull())
+      {
+        AppendUnique(m_edgeVertexOffsets, m_edgeVertices, vertexMap.FindIndex(vertex) - 1);
+      }
+    }
+    m_edgeVertexOffsets.push_back(static_cast<int>(m_edgeVertices.size()));
+  }
+
+  // Face -> neighbouring faces via shared edges
+  m_faceFaceOffsets.reserve(faceCount + 1);
+  m_faceFaceOffsets.push_back(0);
+  for (int face = 0; face < faceCount; face++)
+  {
+    for (const int edge : FaceEdges(face))
+    {
+      for (const int neighbor : EdgeFaces(edge))
+      {
+        if (neighbor != face)
+        {
+          m_faceFaces.push_back(neighbor);
+          m_faceFaceEdges.push_back(edge);
+        }
+      }
+    }
+    m_faceFaceOffsets.push_back(static_cast<int>(m_faceFaces.size()));
+  }
+
+  // Convexity of the edges shared by exactly two faces
+  m_edgeConvexity.assign(edgeCount, Convexity::Unknown);
+  if (classifyConvexity)
+  {
+    const std::vector<TopoDS_Face>& faces = index.Faces();
+    const std::vector<TopoDS_Edge>& edges = index.Edges();
+    parallel::For(0,
+                  static_cast<size_t>(edgeCount),
+                  [&](size_t edge)
+                  {
+                    const Row edgeFaces = EdgeFaces(static_cast<int>(edge));
+                    if (edgeFaces.size() == 2)
+                    {
+                      m_edgeConvexity[edge] =
+                        ClassifyEdge(edges[edge], faces[edgeFaces[0]], faces[edgeFaces[1]]);
+                    }
+                  });
+  }
+}
+
+AdjacencyGraph::AdjacencyGraph(const TopoDS_Shape& shape, bool classifyConvexity)
+    : AdjacencyGraph(TopologyIndex(shape), classifyConvexity)
+{
+}
+
+int AdjacencyGraph::NbFaces() const
+{
+  return static_cast<int>(m_faceEdgeOffsets.size()) - 1;
+}
+
+int AdjacencyGraph::NbEdges() const
+{
+  return static_cast<int>(m_edgeFaceOffsets.size()) - 1;
+}
+
+int AdjacencyGraph::NbVertices() const
+{
+  return m_vertexCount;
+}
+
+AdjacencyGraph::Row AdjacencyGraph::MakeRow(const std::vector<int>& offsets,
+                                            const std::vector<int>& values,
+                                            int                     row)
+{
+  if (row < 0 || row + 1 >= static_cast<int>(offsets.size()))
+  {
+    throw OCCInvalidArgumentException("AdjacencyGraph ID out of range");
+  }
+  Row ret;
+  ret.first = values.data() + offsets[row];
+  ret.last  = values.data() + offsets[row + 1];
+  return ret;
+}
+
+AdjacencyGraph::Row AdjacencyGraph::FaceEdges(int face) const
+{
+  return MakeRow(m_faceEdgeOffsets, m_faceEdges, face);
+}
+
+AdjacencyGraph::Row AdjacencyGraph::EdgeFaces(int edge) const
+{
+  return MakeRow(m_edgeFaceOffsets, m_edgeFaces, edge);
+}
+
+AdjacencyGraph::Row AdjacencyGraph::EdgeVertices(int edge) const
+{
+  return MakeRow(m_edgeVertexOffsets, m_edgeVertices, edge);
+}
+
+AdjacencyGraph::Row AdjacencyGraph::FaceNeighbors(int face) const
+{
+  return MakeRow(m_faceFaceOffsets, m_faceFaces, face);
+}
+
+AdjacencyGraph::Row AdjacencyGraph::FaceNeighborEdges(int face) const
+{
+  return MakeRow(m_faceFaceOffsets, m_faceFaceEdges, face);
+}
+
+Convexity AdjacencyGraph::EdgeConvexity(int edge) const
+{
+  if (edge < 0 || edge >= NbEdges())
+  {
+    throw OCCInvalidArgumentException("AdjacencyGraph ID out of range");
+  }
+  return m_edgeConvexity[edge];
+}
+
+std::vector<int> AdjacencyGraph::ReachableFaces(int startFace) const
+{
+  return ReachableFaces(startFace, [](int /* edge */) { return true; });
+}
+
+std::vector<int> AdjacencyGraph::FaceComponents() const
+{
+  return FaceComponents([](int /* edge */) { return true; });
+}
+
+} // namespace occutils::shape_components
@@ -3,14 +3,23 @@
 // file alone.
 
 // The following lines pull in the real occutils*.cc files.
+#include "occutils-adjacency-graph.cc"
 #include "occutils-axis.cc"
+#include "occutils-boolean-batch.cc"
+#include "occutils-boolean-cache.cc"
+#include "occutils-boolean-incremental-cutter.cc"
+#include "occutils-boolean-session.cc"
 #include "occutils-boolean.cc"
+#include "occutils-bounding-box-broad-phase.cc"
+#include "occutils-bounding-box-cache.cc"
+#include "occutils-bounding-box-index.cc"
 #include "occutils-bounding-box.cc"
 #include "occutils-compound.cc"
 #include "occutils-curve.cc"
 #include "occutils-direction.cc"
 #include "occutils-edge.cc"
 #include "occutils-equality.cc"
+#include "occutils-face-table.cc"
 #include "occutils-face.cc"
 #include "occutils-fillet.cc"
 #include "occutils-io.cc"
@@ -22,9 +31,15 @@
 #include "occutils-primitive.cc"
 #include "occutils-print-occ.cc"
 #include "occutils-shape-components.cc"
+#include "occutils-shape-query.cc"
 #include "occutils-shape.cc"
+#include "occutils-slicer.cc"
 #include "occutils-step-export.cc"
+#include "occutils-surface-cache.cc"
+#include "occutils-surface-grid.cc"
 #include "occutils-surface.cc"
+#include "occutils-topology-index.cc"
+#include "occutils-vertex-export.cc"
 #include "occutils-wire.cc"
 #include "xde/occutils-xde-app.cc"
 #include "xde/occutils-xde-doc.cc"
@@ -0,0 +1,58 @@
+#include "occutils/occutils-boolean-batch.h"
+
+// std includes
+#include <chrono>
+#include <utility>
+
+// occutils includes
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::boolean
+{
+
+namespace
+{
+
+/**
+ * Run a single job. Exceptions are converted into a status, as they must not
+ * escape a worker of the thread pool.
+ */
+JobResult RunJob(const Job& job)
+{
+  ProgressControl control;
+  control.timeBudgetSeconds = job.timeBudgetSeconds;
+
+  // Concurrent jobs may share argument or tool shapes, so they must not
+  // modify them in place
+  BooleanOptions options = job.options;
+  options.nonDestructive = true;
+
+  ControlledResult result = Perform(job.operation, job.arguments, job.tools, control, options);
+
+  JobResult ret;
+  ret.shape  = result.shape;
+  ret.status = result.status;
+  ret.error  = std::move(result.error);
+  return ret;
+}
+
+} // namespace
+
+std::vector<JobResult> RunBatch(const std::vector<Job>& jobs, size_t maxWorkers)
+{
+  std::vector<JobResult> results(jobs.size());
+  parallel::For(
+    0,
+    jobs.size(),
+    [&](size_t i)
+    {
+      const auto start   = std::chrono::steady_clock::now();
+      results[i]         = RunJob(jobs[i]);
+      const auto end     = std::chrono::steady_clock::now();
+      results[i].seconds = std::chrono::duration<double>(end - start).count();
+    },
+    maxWorkers);
+  return results;
+}
+
+} // namespace occutils::boolean
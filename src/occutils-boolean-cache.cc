@@ -0,0 +1,211 @@
+#include "occutils/occutils-boolean-cache.h"
+
+// std includes
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// OCC includes
+#include <BRepTools.hxx>
+#include <TopTools_FormatVersion.hxx>
+
+namespace occutils::boolean
+{
+
+namespace
+{
+
+/**
+ * Incrementally computes two independent 64 bit hashes (FNV-1a and a
+ * multiply-rotate hash) over a byte stream, giving a 128 bit key that makes
+ * collisions practically impossible.
+ */
+class ContentHasher
+{
+public:
+  void Add(const void* data, size_t size)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      m_first = (m_first ^ bytes[i]) * 0x100000001B3ULL;
+      m_second =
+        ((m_second + bytes[i]) * 0xC2B2AE3D27D4EB4FULL) ^ ((m_second << 31) | (m_second >> 33));
+    }
+  }
+
+  template <typename T>
+  void Add(const T& value)
+  {
+    Add(&value, sizeof(T));
+  }
+
+  /**
+   * Hash the serialized geometry and topology of the shape, including its
+   * location and orientation. Triangulations are left out, so meshing a shape
+   * does not change its hash.
+   *
+   * @return The size of the serialized shape, in bytes.
+   */
+  size_t AddShape(const TopoDS_Shape& shape)
+  {
+    const std::string content = Serialize(shape);
+    Add(content.size());
+    Add(content.data(), content.size());
+    return content.size();
+  }
+
+  [[nodiscard]] ResultCache::Key Key() const
+  {
+    return {m_first, m_second};
+  }
+
+  static std::string Serialize(const TopoDS_Shape& shape)
+  {
+    if (shape.IsNull())
+    {
+      return {};
+    }
+    std::ostringstream stream;
+    BRepTools::Write(shape, stream, Standard_False, Standard_False, TopTools_FormatVersion_CURRENT);
+    return stream.str();
+  }
+
+private:
+  uint64_t m_first  = 0xCBF29CE484222325ULL;
+  uint64_t m_second = 0x27D4EB2F165667C5ULL;
+};
+
+} // namespace
+
+ResultCache::ResultCache(size_t maxBytes) : m_maxBytes(maxBytes)
+{
+}
+
+TopoDS_Shape ResultCache::Perform(Operation                             operation,
+                                  const NCollection_List<TopoDS_Shape>& arguments,
+                                  const NCollection_List<TopoDS_Shape>& tools,
+                                  const BooleanOptions&                 options)
+{
+  const Key    key = MakeKey(operation, arguments, tools, options);
+  TopoDS_Shape result;
+  if (Lookup(key, result))
+  {
+    return result;
+  }
+  result = boolean::Perform(operation, arguments, tools, options);
+  if (!result.IsNull())
+  {
+    Insert(key, result);
+  }
+  return result;
+}
+
+ResultCache::Key ResultCache::MakeKey(Operation                             operation,
+                                      const NCollection_List<TopoDS_Shape>& arguments,
+                                      const NCollection_List<TopoDS_Shape>& tools,
+                                      const BooleanOptions&                 options)
+{
+  ContentHasher hasher;
+  hasher.Add(static_cast<int>(operation));
+  hasher.Add(options.fuzzyValue);
+  hasher.Add(static_cast<int>(options.glue));
+  hasher.Add(options.useOBB);
+  hasher.Add(options.nonDestructive);
+  hasher.Add(options.checkInverted);
+  hasher.Add(options.unifySameDomain);
+  // The sizes separate arguments from tools
+  hasher.Add(static_cast<size_t>(arguments.Size()));
+  for (const TopoDS_Shape& argument : arguments)
+  {
+    hasher.AddShape(argument);
+  }
+  hasher.Add(static_cast<size_t>(tools.Size()));
+  for (const TopoDS_Shape& tool : tools)
+  {
+    hasher.AddShape(tool);
+  }
+  return hasher.Key();
+}
+
+bool ResultCache::Lookup(const Key& key, TopoDS_Shape& result)
+{
+  std::lock_guard lock(m_mutex);
+  const auto      it = m_index.find(key);
+  if (it == m_index.end())
+  {
+    m_misses++;
+    return false;
+  }
+  // Move to the front, i.e. mark as most recently used
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  result = it->second->shape;
+  m_hits++;
+  return true;
+}
+
+void ResultCache::Insert(const Key& key, const TopoDS_Shape& result)
+{
+  // The serialized size is a good estimate of the in-memory size, and
+  // computing it outside of the lock keeps other callers unblocked.
+  const size_t bytes = ContentHasher::Serialize(result).size() + sizeof(Entry);
+  if (bytes > m_maxBytes)
+  {
+    return;
+  }
+
+  std::lock_guard lock(m_mutex);
+  if (const auto it = m_index.find(key); it != m_index.end())
+  {
+    m_bytes -= it->second->bytes;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+  }
+  m_entries.push_front({key, result, bytes});
+  m_index[key] = m_entries.begin();
+  m_bytes += bytes;
+  Evict();
+}
+
+void ResultCache::Clear()
+{
+  std::lock_guard lock(m_mutex);
+  m_entries.clear();
+  m_index.clear();
+  m_bytes = 0;
+}
+
+size_t ResultCache::Hits() const
+{
+  return m_hits;
+}
+
+size_t ResultCache::Misses() const
+{
+  return m_misses;
+}
+
+size_t ResultCache::Size() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_entries.size();
+}
+
+size_t ResultCache::Bytes() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_bytes;
+}
+
+void ResultCache::Evict()
+{
+  while (m_bytes > m_maxBytes && !m_entries.empty())
+  {
+    const Entry& oldest = m_entries.back();
+    m_bytes -= oldest.bytes;
+    m_index.erase(oldest.key);
+    m_entries.pop_back();
+  }
+}
+
+} // namespace occutils::boolean
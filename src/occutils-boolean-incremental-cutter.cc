@@ -0,0 +1,255 @@
+#include "occutils/occutils-boolean-incremental-cutter.h"
+
+// std includes
+#include <chrono>
+
+// OCC includes
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRep_Tool.hxx>
+#include <NCollection_UBTreeFiller.hxx>
+#include <Precision.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+
+namespace occutils::boolean
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * Selects the slots of the face tree whose box overlaps a given box
+ */
+class FaceBoxSelector : public NCollection_UBTree<int, Bnd_Box>::Selector
+{
+public:
+  explicit FaceBoxSelector(const Bnd_Box& box) : m_box(box)
+  {
+  }
+
+  Standard_Boolean Reject(const Bnd_Box& box) const override
+  {
+    return m_box.IsOut(box);
+  }
+
+  Standard_Boolean Accept(const int& slot) override
+  {
+    m_slots.push_back(slot);
+    return Standard_True;
+  }
+
+  [[nodiscard]] const std::vector<int>& Slots() const
+  {
+    return m_slots;
+  }
+
+private:
+  Bnd_Box          m_box;
+  std::vector<int> m_slots;
+};
+
+Bnd_Box FaceBox(const TopoDS_Face& face)
+{
+  Bnd_Box box;
+  BRepBndLib::Add(face, box);
+  return box;
+}
+
+} // namespace
+
+IncrementalCutter::IncrementalCutter(const TopoDS_Shape& stock, const BooleanOptions& options)
+    : m_stock(stock),
+      m_options(options)
+{
+  if (stock.IsNull())
+  {
+    throw OCCInvalidArgumentException("IncrementalCutter requires a non-null stock");
+  }
+  Rebuild();
+}
+
+bool IncrementalCutter::Cut(const TopoDS_Shape& tool)
+{
+  if (tool.IsNull())
+  {
+    throw OCCInvalidArgumentException("IncrementalCutter::Cut requires a non-null tool");
+  }
+  const auto stepStart = Clock::now();
+  StepStats  step;
+
+  // Broad phase: which stock faces can the tool touch?
+  const auto queryStart = Clock::now();
+  Bnd_Box    toolBox;
+  BRepBndLib::Add(tool, toolBox);
+  toolBox.Enlarge(m_options.fuzzyValue + Precision::Confusion());
+  step.candidateFaces = Query(toolBox).size();
+  // A tool touching no face is either outside the stock (nothing to do) or
+  // entirely inside the material (creates a void, so it has to be cut).
+  step.skipped      = step.candidateFaces == 0 && !IsInsideMaterial(tool);
+  step.querySeconds = SecondsSince(queryStart);
+
+  if (!step.skipped)
+  {
+    const auto         booleanStart = Clock::now();
+    const TopoDS_Shape result       = boolean::Cut(m_stock, tool, m_options);
+    step.booleanSeconds             = SecondsSince(booleanStart);
+
+    if (result.IsNull())
+    {
+      step.failed = true;
+    }
+    else
+    {
+      const auto indexStart = Clock::now();
+      m_stock               = result;
+      Update();
+      step.indexSeconds = SecondsSince(indexStart);
+    }
+  }
+
+  step.stockFaces = FaceCount();
+  step.seconds    = SecondsSince(stepStart);
+  m_steps.push_back(step);
+  return !step.failed;
+}
+
+const TopoDS_Shape& IncrementalCutter::Stock() const
+{
+  return m_stock;
+}
+
+size_t IncrementalCutter::FaceCount() const
+{
+  return static_cast<size_t>(m_faceSlots.Extent());
+}
+
+std::vector<TopoDS_Face> IncrementalCutter::FacesNear(const Bnd_Box& box) const
+{
+  std::vector<TopoDS_Face> ret;
+  for (const int slot : Query(box))
+  {
+    ret.push_back(m_slots[slot].face);
+  }
+  return ret;
+}
+
+const std::vector<IncrementalCutter::StepStats>& IncrementalCutter::Steps() const
+{
+  return m_steps;
+}
+
+std::vector<int> IncrementalCutter::Query(const Bnd_Box& box) const
+{
+  FaceBoxSelector selector(box);
+  m_tree.Select(selector);
+
+  std::vector<int> ret;
+  for (const int slot : selector.Slots())
+  {
+    if (m_slots[slot].alive)
+    {
+      ret.push_back(slot);
+    }
+  }
+  return ret;
+}
+
+void IncrementalCutter::Rebuild()
+{
+  m_slots.clear();
+  m_faceSlots.Clear();
+  m_tree.Clear();
+
+  NCollection_UBTreeFiller<int, Bnd_Box> filler(m_tree);
+  for (TopExp_Explorer exp(m_stock, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    const TopoDS_Face& face = TopoDS::Face(exp.Current());
+    if (m_faceSlots.IsBound(face))
+    {
+      continue;
+    }
+    const int slot = static_cast<int>(m_slots.size());
+    m_slots.push_back({face, FaceBox(face), true});
+    m_faceSlots.Bind(face, slot);
+    filler.Add(slot, m_slots.back().box);
+  }
+  // Builds a balanced tree
+  filler.Fill();
+}
+
+void IncrementalCutter::Update()
+{
+  // Faces the boolean operation did not touch are shared with the previous
+  // stock, so only new faces need a box computed and inserted.
+  TopTools_DataMapOfShapeInteger faceSlots;
+  for (TopExp_Explorer exp(m_stock, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    const TopoDS_Face& face = TopoDS::Face(exp.Current());
+    if (faceSlots.IsBound(face))
+    {
+      continue;
+    }
+    if (const int* slot = m_faceSlots.Seek(face))
+    {
+      faceSlots.Bind(face, *slot);
+      continue;
+    }
+    const int slot = static_cast<int>(m_slots.size());
+    m_slots.push_back({face, FaceBox(face), true});
+    faceSlots.Bind(face, slot);
+    m_tree.Add(slot, m_slots.back().box);
+  }
+
+  // Retire the slots of faces that are no longer part of the stock
+  size_t deadSlots = 0;
+  for (size_t slot = 0; slot < m_slots.size(); slot++)
+  {
+    const int* current  = faceSlots.Seek(m_slots[slot].face);
+    m_slots[slot].alive = current != nullptr && *current == static_cast<int>(slot);
+    if (!m_slots[slot].alive)
+    {
+      deadSlots++;
+    }
+  }
+  m_faceSlots.Exchange(faceSlots);
+
+  // Incremental insertion degrades the tree over time, and dead slots waste
+  // query time, so rebuild once most slots are dead.
+  if (deadSlots > m_slots.size() / 2)
+  {
+    Rebuild();
+  }
+}
+
+bool IncrementalCutter::IsInsideMaterial(const TopoDS_Shape& tool) const
+{
+  TopExp_Explorer vertexExp(tool, TopAbs_VERTEX);
+  if (!vertexExp.More())
+  {
+    // Nothing to classify, so let the boolean operation decide
+    return true;
+  }
+  const gp_Pnt point = BRep_Tool::Pnt(TopoDS::Vertex(vertexExp.Current()));
+  for (TopExp_Explorer exp(m_stock, TopAbs_SOLID); exp.More(); exp.Next())
+  {
+    BRepClass3d_SolidClassifier classifier(exp.Current(), point, Precision::Confusion());
+    if (classifier.State() != TopAbs_OUT)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace occutils::boolean
@@ -0,0 +1,159 @@
+#include "occutils/occutils-boolean-session.h"
+
+// OCC includes
+#include <BOPAlgo_Operation.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+
+namespace occutils::boolean
+{
+
+namespace
+{
+
+/**
+ * Build the given operation from an already intersected pave filler. The
+ * arguments and tools must be the ones the filler was run on.
+ */
+TopoDS_Shape BuildFromFiller(const BOPAlgo_PaveFiller&             filler,
+                             BOPAlgo_Operation                     operation,
+                             const NCollection_List<TopoDS_Shape>& arguments,
+                             const NCollection_List<TopoDS_Shape>& tools,
+                             const BooleanOptions&                 options)
+{
+  // Constructing from the filler skips the intersection step in Build()
+  BRepAlgoAPI_BooleanOperation algo(filler);
+  algo.SetOperation(operation);
+  algo.SetArguments(arguments);
+  algo.SetTools(tools);
+  algo.SetRunParallel(options.runParallel);
+  algo.SetCheckInverted(options.checkInverted);
+  // Run operation
+  algo.Build();
+  //
+  if (algo.HasErrors())
+  {
+    return {};
+  }
+  if (options.unifySameDomain)
+  {
+    algo.SimplifyResult();
+  }
+  return algo.Shape(); // Raises NotDone if not done.
+}
+
+/**
+ * @return A list holding the given shape, or an empty list if it is null.
+ */
+NCollection_List<TopoDS_Shape> ListOfNonNull(const TopoDS_Shape& shape)
+{
+  NCollection_List<TopoDS_Shape> ret;
+  if (!shape.IsNull())
+  {
+    ret.Append(shape);
+  }
+  return ret;
+}
+
+} // namespace
+
+Session::Session(const NCollection_List<TopoDS_Shape>& arguments,
+                 const NCollection_List<TopoDS_Shape>& tools,
+                 const BooleanOptions&                 options)
+    : m_filler(std::make_unique<BOPAlgo_PaveFiller>()),
+      m_arguments(arguments),
+      m_tools(tools),
+      m_options(options)
+{
+  if (arguments.IsEmpty())
+  {
+    throw OCCInvalidArgumentException("Session requires at least one argument");
+  }
+  if (tools.IsEmpty())
+  {
+    throw OCCInvalidArgumentException("Session requires at least one tool");
+  }
+  // The filler intersects arguments and tools alike
+  NCollection_List<TopoDS_Shape> shapes(arguments);
+  for (const TopoDS_Shape& tool : tools)
+  {
+    shapes.Append(tool);
+  }
+  m_filler->SetArguments(shapes);
+  m_filler->SetRunParallel(options.runParallel);
+  m_filler->SetFuzzyValue(options.fuzzyValue);
+  m_filler->SetGlue(options.glue);
+  m_filler->SetUseOBB(options.useOBB);
+  m_filler->SetNonDestructive(options.nonDestructive);
+  // Run intersection
+  m_filler->Perform();
+}
+
+Session::Session(const TopoDS_Shape&   argument,
+                 const TopoDS_Shape&   tool,
+                 const BooleanOptions& options)
+    : Session(ListOfNonNull(argument), ListOfNonNull(tool), options)
+{
+}
+
+// Defined here, where BOPAlgo_PaveFiller is a complete type
+Session::~Session() = default;
+
+bool Session::IsDone() const
+{
+  return !m_filler->HasErrors();
+}
+
+TopoDS_Shape Session::Fuse() const
+{
+  return Perform(Operation::Fuse);
+}
+
+TopoDS_Shape Session::Cut() const
+{
+  return Perform(Operation::Cut);
+}
+
+TopoDS_Shape Session::CutReversed() const
+{
+  if (!IsDone())
+  {
+    return {};
+  }
+  return BuildFromFiller(*m_filler, BOPAlgo_CUT21, m_arguments, m_tools, m_options);
+}
+
+TopoDS_Shape Session::Common() const
+{
+  return Perform(Operation::Common);
+}
+
+TopoDS_Shape Session::Section() const
+{
+  return Perform(Operation::Section);
+}
+
+TopoDS_Shape Session::Perform(Operation operation) const
+{
+  if (!IsDone())
+  {
+    return {};
+  }
+  switch (operation)
+  {
+    case Operation::Fuse:
+      return BuildFromFiller(*m_filler, BOPAlgo_FUSE, m_arguments, m_tools, m_options);
+    case Operation::Cut:
+      return BuildFromFiller(*m_filler, BOPAlgo_CUT, m_arguments, m_tools, m_options);
+    case Operation::Common:
+      return BuildFromFiller(*m_filler, BOPAlgo_COMMON, m_arguments, m_tools, m_options);
+    case Operation::Section:
+      return BuildFromFiller(*m_filler, BOPAlgo_SECTION, m_arguments, m_tools, m_options);
+  }
+  return {};
+}
+
+} // namespace occutils::boolean
@@ -1,21 +1,323 @@
 #include "occutils/occutils-boolean.h"
 
+// std includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
 // OCC includes
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Section.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
+#include <ShapeUpgrade_UnifySameDomain.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <gp_XYZ.hxx>
 
 // occutils includes
+#include "occutils/occutils-compound.h"
 #include "occutils/occutils-exceptions.h"
 #include "occutils/occutils-list-utils.h"
+#include "occutils/occutils-parallel.h"
 #include "occutils/occutils-shape.h"
 
 namespace occutils::boolean
 {
 
+namespace
+{
+
+std::mutex     defaultOptionsMutex;
+BooleanOptions defaultOptions;
+
+/**
+ * Configure the given boolean algorithm with the given arguments, tools and
+ * options, run it and return its result (or a null shape on failure).
+ */
+template <typename Algo>
+TopoDS_Shape RunAlgorithm(const NCollection_List<TopoDS_Shape>& arguments,
+                          const NCollection_List<TopoDS_Shape>& tools,
+                          const BooleanOptions&                 options,
+                          const Message_ProgressRange&          progress)
+{
+  Algo algo;
+  algo.SetArguments(arguments);
+  algo.SetTools(tools);
+  algo.SetRunParallel(options.runParallel);
+  algo.SetFuzzyValue(options.fuzzyValue);
+  algo.SetGlue(options.glue);
+  algo.SetUseOBB(options.useOBB);
+  algo.SetNonDestructive(options.nonDestructive);
+  algo.SetCheckInverted(options.checkInverted);
+  // Run operation
+  algo.Build(progress);
+  //
+  if (algo.HasErrors())
+  {
+    return {};
+  }
+  if (options.unifySameDomain)
+  {
+    algo.SimplifyResult();
+  }
+  return algo.Shape(); // Raises NotDone if not done.
+}
+
+/**
+ * Recursively split the shape indices in [first, last) at the median of their
+ * box centers along the axis of the largest spread, until every group holds at
+ * most leafSize shapes. Groups are appended in kd-tree order, so neighbouring
+ * groups are also close in space.
+ */
+void ClusterByBoxCenter(std::vector<size_t>::iterator     first,
+                        std::vector<size_t>::iterator     last,
+                        const std::vector<gp_XYZ>&        centers,
+                        size_t                            leafSize,
+                        std::vector<std::vector<size_t>>& groups)
+{
+  const auto count = static_cast<size_t>(std::distance(first, last));
+  if (count <= leafSize)
+  {
+    groups.emplace_back(first, last);
+    return;
+  }
+  // Find the axis with the largest spread of centers
+  gp_XYZ minCorner = centers[*first];
+  gp_XYZ maxCorner = centers[*first];
+  for (auto it = first; it != last; ++it)
+  {
+    for (int axis = 1; axis <= 3; axis++)
+    {
+      minCorner.SetCoord(axis, std::min(minCorner.Coord(axis), centers[*it].Coord(axis)));
+      maxCorner.SetCoord(axis, std::max(maxCorner.Coord(axis), centers[*it].Coord(axis)));
+    }
+  }
+  const gp_XYZ spread    = maxCorner - minCorner;
+  int          splitAxis = 1;
+  for (int axis = 2; axis <= 3; axis++)
+  {
+    if (spread.Coord(axis) > spread.Coord(splitAxis))
+    {
+      splitAxis = axis;
+    }
+  }
+  // Split at the median
+  const auto middle = first + static_cast<std::ptrdiff_t>(count / 2);
+  std::nth_element(first,
+                   middle,
+                   last,
+                   [&](size_t a, size_t b)
+                   { return centers[a].Coord(splitAxis) < centers[b].Coord(splitAxis); });
+  ClusterByBoxCenter(first, middle, centers, leafSize, groups);
+  ClusterByBoxCenter(middle, last, centers, leafSize, groups);
+}
+
+/**
+ * The bounding box of a single shape, as used by the broad phase. Only the
+ * box matching the broad phase mode is computed.
+ */
+struct BroadPhaseBox
+{
+  Bnd_Box box;
+  Bnd_OBB obb;
+};
+
+BroadPhaseBox ComputeBroadPhaseBox(const TopoDS_Shape& shape, BroadPhase mode, double gap)
+{
+  BroadPhaseBox ret;
+  if (mode == BroadPhase::OrientedBox)
+  {
+    BRepBndLib::AddOBB(shape, ret.obb);
+    if (!ret.obb.IsVoid())
+    {
+      ret.obb.Enlarge(gap);
+    }
+  }
+  else
+  {
+    BRepBndLib::Add(shape, ret.box);
+    ret.box.Enlarge(gap);
+  }
+  return ret;
+}
+
+bool Overlap(const BroadPhaseBox& a, const BroadPhaseBox& b, BroadPhase mode)
+{
+  if (mode == BroadPhase::OrientedBox)
+  {
+    return !a.obb.IsVoid() && !b.obb.IsVoid() && !a.obb.IsOut(b.obb);
+  }
+  return !a.box.IsOut(b.box);
+}
+
+/**
+ * @return The number of distinct sub-shapes of the given type.
+ */
+size_t CountDistinct(const TopoDS_Shape& shape, TopAbs_ShapeEnum type)
+{
+  TopTools_IndexedMapOfShape map;
+  TopExp::MapShapes(shape, type, map);
+  return static_cast<size_t>(map.Extent());
+}
+
+/**
+ * Cull the tools according to options.broadPhase and report the number of
+ * culled tools to culledTools, if given.
+ */
+NCollection_List<TopoDS_Shape> ApplyBroadPhase(const NCollection_List<TopoDS_Shape>& arguments,
+                                               const NCollection_List<TopoDS_Shape>& tools,
+                                               const BooleanOptions&                 options,
+                                               size_t*                               culledTools)
+{
+  CullResult result = CullTools(arguments, tools, options.broadPhase, options.fuzzyValue);
+  if (culledTools != nullptr)
+  {
+    *culledTools = result.culledCount;
+  }
+  return result.tools;
+}
+
+/**
+ * Forwards the progress of a boolean operation to a ProgressControl and
+ * requests a break once the callback cancels or the time budget is exceeded.
+ * OCCT may query UserBreak() from several threads at once.
+ */
+class ControlIndicator : public Message_ProgressIndicator
+{
+public:
+  explicit ControlIndicator(const ProgressControl& control)
+      : m_control(control),
+        m_start(std::chrono::steady_clock::now())
+  {
+  }
+
+  // Called by OCCT with the progress mutex locked, so never concurrently
+  void Show(const Message_ProgressScope& /* scope */, const Standard_Boolean /* isForce */) override
+  {
+    if (m_control.onProgress && !m_control.onProgress(GetPosition()))
+    {
+      m_cancelled = true;
+    }
+  }
+
+  Standard_Boolean UserBreak() override
+  {
+    if (m_cancelled)
+    {
+      return Standard_True;
+    }
+    if (m_control.timeBudgetSeconds > 0.0 && Elapsed() > m_control.timeBudgetSeconds)
+    {
+      m_timedOut = true;
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+  [[nodiscard]] bool TimedOut() const
+  {
+    return m_timedOut;
+  }
+
+  [[nodiscard]] bool Cancelled() const
+  {
+    return m_cancelled;
+  }
+
+  [[nodiscard]] double Elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+private:
+  const ProgressControl&                m_control;
+  std::chrono::steady_clock::time_point m_start;
+  std::atomic<bool>                     m_cancelled{false};
+  std::atomic<bool>                     m_timedOut{false};
+};
+
+} // namespace
+
+void SetDefaultOptions(const BooleanOptions& options)
+{
+  std::lock_guard lock(defaultOptionsMutex);
+  defaultOptions = options;
+}
+
+BooleanOptions DefaultOptions()
+{
+  std::lock_guard lock(defaultOptionsMutex);
+  return defaultOptions;
+}
+
+//------------------------------------------------------------------------------
+
+CullResult CullTools(const NCollection_List<TopoDS_Shape>& arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     BroadPhase                            mode,
+                     double                                gap)
+{
+  CullResult ret;
+  if (mode == BroadPhase::None || arguments.IsEmpty() || tools.IsEmpty())
+  {
+    ret.tools = tools;
+    return ret;
+  }
+
+  std::vector<BroadPhaseBox> argumentBoxes;
+  argumentBoxes.reserve(static_cast<size_t>(arguments.Size()));
+  for (const TopoDS_Shape& argument : arguments)
+  {
+    argumentBoxes.push_back(ComputeBroadPhaseBox(argument, mode, gap));
+  }
+
+  // Tool lists may be long (e.g. thousands of drill holes), so test them
+  // concurrently and collect the survivors in input order afterwards.
+  const std::vector<TopoDS_Shape> toolVector = list_utils::ToSTLVector(tools);
+  std::vector<char>               keep(toolVector.size(), 0);
+  parallel::For(0,
+                toolVector.size(),
+                [&](size_t i)
+                {
+                  const BroadPhaseBox toolBox = ComputeBroadPhaseBox(toolVector[i], mode, 0.0);
+                  keep[i] = std::any_of(argumentBoxes.begin(),
+                                        argumentBoxes.end(),
+                                        [&](const BroadPhaseBox& argumentBox)
+                                        { return Overlap(argumentBox, toolBox, mode); });
+                });
+
+  for (size_t i = 0; i < toolVector.size(); i++)
+  {
+    if (keep[i])
+    {
+      ret.tools.Append(toolVector[i]);
+    }
+    else
+    {
+      ret.culledCount++;
+    }
+  }
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
 TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& arguments,
-                  const NCollection_List<TopoDS_Shape>& tools)
+                  const NCollection_List<TopoDS_Shape>& tools,
+                  const BooleanOptions&                 options,
+                  const Message_ProgressRange&          progress)
 {
   if (arguments.Size() + tools.Size() == 1)
   {
@@ -51,122 +353,210 @@ TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& arguments,
     throw OCCInvalidArgumentException("Fuse tools must have at least one shape!");
   }
 
-  // Configure fuse
-  BRepAlgoAPI_Fuse fuse;
-  fuse.SetArguments(arguments);
-  fuse.SetTools(tools);
-  // Run fuse
-  fuse.Build();
-  //
-  if (bool hasErr = fuse.HasErrors(); hasErr)
-  {
-    return {};
-  }
-  return fuse.Shape(); // Raises NotDone if not done.
+  return RunAlgorithm<BRepAlgoAPI_Fuse>(arguments, tools, options, progress);
 }
 
-TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& shapes)
+TopoDS_Shape Fuse(const NCollection_List<TopoDS_Shape>& shapes, const BooleanOptions& options)
 {
   // We need "tools" and "arguments".
   // For fuse, the exact split does not matter,
   // but each must be size >= 1!
   auto [first, second] = list_utils::SplitIntoHeadAndTail(shapes, 1);
-  return Fuse(second, first);
+  return Fuse(second, first, options);
 }
 
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes)
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes, const BooleanOptions& options)
 {
-  return Fuse(list_utils::ToOCCList(shapes));
+  return Fuse(list_utils::ToOCCList(shapes), options);
 }
 
-TopoDS_Shape Fuse(const std::vector<TopoDS_Solid>& shapes)
+TopoDS_Shape Fuse(const std::vector<TopoDS_Solid>& shapes, const BooleanOptions& options)
 {
-  return Fuse(shapes::FromSolids(shapes));
+  return Fuse(shapes::FromSolids(shapes), options);
 }
 
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Solid>& shapes)
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Solid>& shapes, const BooleanOptions& options)
 {
-  return Fuse(shapes::FromSolids(shapes));
+  return Fuse(shapes::FromSolids(shapes), options);
 }
 
-TopoDS_Shape Fuse(const std::vector<TopoDS_Face>& shapes)
+TopoDS_Shape Fuse(const std::vector<TopoDS_Face>& shapes, const BooleanOptions& options)
 {
-  return Fuse(shapes::FromFaces(shapes));
+  return Fuse(shapes::FromFaces(shapes), options);
 }
 
-TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes)
+TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes, const BooleanOptions& options)
 {
-  return Fuse(shapes::FromFaces(shapes));
+  return Fuse(shapes::FromFaces(shapes), options);
+}
+
+TopoDS_Shape FuseBalanced(const NCollection_List<TopoDS_Shape>& shapes,
+                          const BooleanOptions&                 options,
+                          size_t                                leafSize,
+                          size_t                                maxThreads)
+{
+  if (leafSize < 2)
+  {
+    throw OCCInvalidArgumentException("FuseBalanced leaf size must be at least 2!");
+  }
+  if (static_cast<size_t>(shapes.Size()) <= leafSize)
+  {
+    // Small inputs are fused in one go, exactly like Fuse()
+    return Fuse(shapes, options);
+  }
+  // Concurrent operations may share sub-shapes of the inputs (e.g. located
+  // instances of the same solid), so they must not modify them in place
+  BooleanOptions treeOptions = options;
+  treeOptions.nonDestructive = true;
+
+  const std::vector<TopoDS_Shape> inputs = list_utils::ToSTLVector(shapes);
+
+  // Compute the bounding box centers of all inputs
+  std::vector<gp_XYZ> centers(inputs.size());
+  parallel::For(
+    0,
+    inputs.size(),
+    [&](size_t i)
+    {
+      Bnd_Box box;
+      BRepBndLib::Add(inputs[i], box);
+      if (!box.IsVoid())
+      {
+        centers[i] = (box.CornerMin().XYZ() + box.CornerMax().XYZ()) * 0.5;
+      }
+    },
+    maxThreads);
+
+  // Cluster the inputs spatially
+  std::vector<size_t> indices(inputs.size());
+  std::iota(indices.begin(), indices.end(), size_t{0});
+  std::vector<std::vector<size_t>> groups;
+  ClusterByBoxCenter(indices.begin(), indices.end(), centers, leafSize, groups);
+
+  // Fuse each cluster on its own
+  std::vector<TopoDS_Shape> level(groups.size());
+  parallel::For(
+    0,
+    groups.size(),
+    [&](size_t i)
+    {
+      NCollection_List<TopoDS_Shape> group;
+      for (const size_t index : groups[i])
+      {
+        group.Append(inputs[index]);
+      }
+      level[i] = Fuse(group, treeOptions);
+    },
+    maxThreads);
+
+  // Merge neighbouring partial results up the tree
+  while (level.size() > 1)
+  {
+    std::vector<TopoDS_Shape> next((level.size() + 1) / 2);
+    parallel::For(
+      0,
+      next.size(),
+      [&](size_t i)
+      {
+        const TopoDS_Shape& first = level[2 * i];
+        if (2 * i + 1 == level.size())
+        {
+          next[i] = first; // Odd one out, pass on to the next level
+          return;
+        }
+        const TopoDS_Shape& second = level[2 * i + 1];
+        if (first.IsNull() || second.IsNull())
+        {
+          return; // A failed operation fails the whole fuse
+        }
+        next[i] = Fuse(list_utils::ToOCCList({first}),
+                       list_utils::ToOCCList({second}),
+                       treeOptions);
+      },
+      maxThreads);
+    level = std::move(next);
+  }
+  return level.front();
 }
 
 //------------------------------------------------------------------------------
 
 TopoDS_Shape Cut(const NCollection_List<TopoDS_Shape>& positive,
-                 const NCollection_List<TopoDS_Shape>& negative)
+                 const NCollection_List<TopoDS_Shape>& negative,
+                 const BooleanOptions&                 options,
+                 size_t*                               culledTools,
+                 const Message_ProgressRange&          progress)
 {
   if (positive.Size() == 0)
   {
     throw OCCInvalidArgumentException("Cut positive must have at least one shape!");
   }
-  if (negative.Size() == 0)
+  const NCollection_List<TopoDS_Shape> tools =
+    ApplyBroadPhase(positive, negative, options, culledTools);
+  if (tools.Size() == 0)
   {
     // Just fuse positive
-    return Fuse(positive);
-  }
-  // Configure fuse
-  BRepAlgoAPI_Cut cut;
-  cut.SetArguments(positive);
-  cut.SetTools(negative);
-  // Run cut
-  cut.Build();
-  //
-  if (bool hasErr = cut.HasErrors(); hasErr)
-  {
-    return {};
+    return Fuse(positive, options);
   }
-  return cut.Shape(); // Raises NotDone if not done.
+  return RunAlgorithm<BRepAlgoAPI_Cut>(positive, tools, options, progress);
 }
 
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const TopoDS_Shape& negative)
+TopoDS_Shape Cut(const TopoDS_Shape&   positive,
+                 const TopoDS_Shape&   negative,
+                 const BooleanOptions& options)
 {
-  return Cut(list_utils::ToOCCList({positive}), list_utils::ToOCCList({negative}));
+  return Cut(list_utils::ToOCCList({positive}), list_utils::ToOCCList({negative}), options);
 }
 
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const NCollection_List<TopoDS_Shape>& negative)
+TopoDS_Shape Cut(const TopoDS_Shape&                   positive,
+                 const NCollection_List<TopoDS_Shape>& negative,
+                 const BooleanOptions&                 options)
 {
-  return Cut(list_utils::ToOCCList({positive}), negative);
+  return Cut(list_utils::ToOCCList({positive}), negative, options);
 }
 
-TopoDS_Shape Cut(const TopoDS_Shape& positive, const std::initializer_list<TopoDS_Shape>& negative)
+TopoDS_Shape Cut(const TopoDS_Shape&                        positive,
+                 const std::initializer_list<TopoDS_Shape>& negative,
+                 const BooleanOptions&                      options)
 {
-  return Cut(list_utils::ToOCCList({positive}), list_utils::ToOCCList(negative));
+  return Cut(list_utils::ToOCCList({positive}), list_utils::ToOCCList(negative), options);
 }
 
 TopoDS_Shape Cut(const std::vector<TopoDS_Solid>& positive,
-                 const std::vector<TopoDS_Solid>& negative)
+                 const std::vector<TopoDS_Solid>& negative,
+                 const BooleanOptions&            options)
 {
-  return Cut(shapes::FromSolids(positive), shapes::FromSolids(negative));
+  return Cut(shapes::FromSolids(positive), shapes::FromSolids(negative), options);
 }
 
-TopoDS_Shape Cut(const TopoDS_Solid& positive, const std::vector<TopoDS_Solid>& negative)
+TopoDS_Shape Cut(const TopoDS_Solid&              positive,
+                 const std::vector<TopoDS_Solid>& negative,
+                 const BooleanOptions&            options)
 {
-  return Cut({positive}, shapes::FromSolids(negative));
+  return Cut({positive}, shapes::FromSolids(negative), options);
 }
 
-TopoDS_Shape Cut(const std::vector<TopoDS_Face>& positive, const std::vector<TopoDS_Face>& negative)
+TopoDS_Shape Cut(const std::vector<TopoDS_Face>& positive,
+                 const std::vector<TopoDS_Face>& negative,
+                 const BooleanOptions&           options)
 {
-  return Cut(shapes::FromFaces(positive), shapes::FromFaces(negative));
+  return Cut(shapes::FromFaces(positive), shapes::FromFaces(negative), options);
 }
 
-TopoDS_Shape Cut(const TopoDS_Face& positive, const std::vector<TopoDS_Face>& negative)
+TopoDS_Shape Cut(const TopoDS_Face&              positive,
+                 const std::vector<TopoDS_Face>& negative,
+                 const BooleanOptions&           options)
 {
-  return Cut({positive}, shapes::FromFaces(negative));
+  return Cut({positive}, shapes::FromFaces(negative), options);
 }
 
 //------------------------------------------------------------------------------
 
 TopoDS_Shape Common(const NCollection_List<TopoDS_Shape>& arguments,
-                    const NCollection_List<TopoDS_Shape>& tools)
+                    const NCollection_List<TopoDS_Shape>& tools,
+                    const BooleanOptions&                 options,
+                    size_t*                               culledTools,
+                    const Message_ProgressRange&          progress)
 {
   if (arguments.Size() == 0)
   {
@@ -176,61 +566,72 @@ TopoDS_Shape Common(const NCollection_List<TopoDS_Shape>& arguments,
   {
     throw OCCInvalidArgumentException("Common tools must have at least one shape!");
   }
-  // Configure common operation
-  BRepAlgoAPI_Common common;
-  common.SetArguments(arguments);
-  common.SetTools(tools);
-  // Run common operation
-  common.Build();
-  //
-  if (bool hasErr = common.HasErrors(); hasErr)
+  const NCollection_List<TopoDS_Shape> keptTools =
+    ApplyBroadPhase(arguments, tools, options, culledTools);
+  if (keptTools.Size() == 0)
   {
-    return {};
+    // Nothing overlaps => nothing in common
+    return compound::From(NCollection_List<TopoDS_Shape>());
   }
-  return common.Shape();
+  return RunAlgorithm<BRepAlgoAPI_Common>(arguments, keptTools, options, progress);
 }
 
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const TopoDS_Shape& tools)
+TopoDS_Shape Common(const TopoDS_Shape&   arguments,
+                    const TopoDS_Shape&   tools,
+                    const BooleanOptions& options)
 {
-  return Cut(list_utils::ToOCCList({arguments}), list_utils::ToOCCList({tools}));
+  return Common(list_utils::ToOCCList({arguments}), list_utils::ToOCCList({tools}), options);
 }
 
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const NCollection_List<TopoDS_Shape>& tools)
+TopoDS_Shape Common(const TopoDS_Shape&                   arguments,
+                    const NCollection_List<TopoDS_Shape>& tools,
+                    const BooleanOptions&                 options)
 {
-  return Common(list_utils::ToOCCList({arguments}), tools);
+  return Common(list_utils::ToOCCList({arguments}), tools, options);
 }
 
-TopoDS_Shape Common(const TopoDS_Shape& arguments, const std::initializer_list<TopoDS_Shape>& tools)
+TopoDS_Shape Common(const TopoDS_Shape&                        arguments,
+                    const std::initializer_list<TopoDS_Shape>& tools,
+                    const BooleanOptions&                      options)
 {
-  return Common(list_utils::ToOCCList({arguments}), list_utils::ToOCCList(tools));
+  return Common(list_utils::ToOCCList({arguments}), list_utils::ToOCCList(tools), options);
 }
 
 TopoDS_Shape Common(const std::vector<TopoDS_Solid>& arguments,
-                    const std::vector<TopoDS_Solid>& tools)
+                    const std::vector<TopoDS_Solid>& tools,
+                    const BooleanOptions&            options)
 {
-  return Common(shapes::FromSolids(arguments), shapes::FromSolids(tools));
+  return Common(shapes::FromSolids(arguments), shapes::FromSolids(tools), options);
 }
 
-TopoDS_Shape Common(const TopoDS_Solid& arguments, const std::vector<TopoDS_Solid>& tools)
+TopoDS_Shape Common(const TopoDS_Solid&              arguments,
+                    const std::vector<TopoDS_Solid>& tools,
+                    const BooleanOptions&            options)
 {
-  return Common({arguments}, shapes::FromSolids(tools));
+  return Common({arguments}, shapes::FromSolids(tools), options);
 }
 
 TopoDS_Shape Common(const std::vector<TopoDS_Face>& arguments,
-                    const std::vector<TopoDS_Face>& tools)
+                    const std::vector<TopoDS_Face>& tools,
+                    const BooleanOptions&           options)
 {
-  return Common(shapes::FromFaces(arguments), shapes::FromFaces(tools));
+  return Common(shapes::FromFaces(arguments), shapes::FromFaces(tools), options);
 }
 
-TopoDS_Shape Common(const TopoDS_Face& arguments, const std::vector<TopoDS_Face>& tools)
+TopoDS_Shape Common(const TopoDS_Face&              arguments,
+                    const std::vector<TopoDS_Face>& tools,
+                    const BooleanOptions&           options)
 {
-  return Common({arguments}, shapes::FromFaces(tools));
+  return Common({arguments}, shapes::FromFaces(tools), options);
 }
 
 //------------------------------------------------------------------------------
 
 TopoDS_Shape Section(const NCollection_List<TopoDS_Shape>& arguments,
-                     const NCollection_List<TopoDS_Shape>& tools)
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     const BooleanOptions&                 options,
+                     size_t*                               culledTools,
+                     const Message_ProgressRange&          progress)
 {
   if (arguments.Size() == 0)
   {
@@ -240,56 +641,182 @@ TopoDS_Shape Section(const NCollection_List<TopoDS_Shape>& arguments,
   {
     throw OCCInvalidArgumentException("Section tools must have at least one shape!");
   }
-  // Configure section operation
-  BRepAlgoAPI_Section section;
-  section.SetArguments(arguments);
-  section.SetTools(tools);
-  // Run section operation
-  section.Build();
-  //
-  if (bool hasErr = section.HasErrors(); hasErr)
+  const NCollection_List<TopoDS_Shape> keptTools =
+    ApplyBroadPhase(arguments, tools, options, culledTools);
+  if (keptTools.Size() == 0)
   {
-    return {};
+    // Nothing overlaps => no section edges
+    return compound::From(NCollection_List<TopoDS_Shape>());
   }
-  return section.Shape();
+  return RunAlgorithm<BRepAlgoAPI_Section>(arguments, keptTools, options, progress);
 }
 
-TopoDS_Shape Section(const TopoDS_Shape& arguments, const TopoDS_Shape& tools)
+TopoDS_Shape Section(const TopoDS_Shape&   arguments,
+                     const TopoDS_Shape&   tools,
+                     const BooleanOptions& options)
 {
-  return Section(list_utils::ToOCCList({arguments}), list_utils::ToOCCList({tools}));
+  return Section(list_utils::ToOCCList({arguments}), list_utils::ToOCCList({tools}), options);
 }
 
-TopoDS_Shape Section(const TopoDS_Shape& arguments, const NCollection_List<TopoDS_Shape>& tools)
+TopoDS_Shape Section(const TopoDS_Shape&                   arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     const BooleanOptions&                 options)
 {
-  return Section(list_utils::ToOCCList({arguments}), tools);
+  return Section(list_utils::ToOCCList({arguments}), tools, options);
 }
 
 TopoDS_Shape Section(const TopoDS_Shape&                        arguments,
-                     const std::initializer_list<TopoDS_Shape>& tools)
+                     const std::initializer_list<TopoDS_Shape>& tools,
+                     const BooleanOptions&                      options)
 {
-  return Section(list_utils::ToOCCList({arguments}), list_utils::ToOCCList(tools));
+  return Section(list_utils::ToOCCList({arguments}), list_utils::ToOCCList(tools), options);
 }
 
 TopoDS_Shape Section(const std::vector<TopoDS_Solid>& arguments,
-                     const std::vector<TopoDS_Solid>& tools)
+                     const std::vector<TopoDS_Solid>& tools,
+                     const BooleanOptions&            options)
 {
-  return Section(shapes::FromSolids(arguments), shapes::FromSolids(tools));
+  return Section(shapes::FromSolids(arguments), shapes::FromSolids(tools), options);
 }
 
-TopoDS_Shape Section(const TopoDS_Solid& arguments, const std::vector<TopoDS_Solid>& tools)
+TopoDS_Shape Section(const TopoDS_Solid&              arguments,
+                     const std::vector<TopoDS_Solid>& tools,
+                     const BooleanOptions&            options)
 {
-  return Section({arguments}, shapes::FromSolids(tools));
+  return Section({arguments}, shapes::FromSolids(tools), options);
 }
 
 TopoDS_Shape Section(const std::vector<TopoDS_Face>& arguments,
-                     const std::vector<TopoDS_Face>& tools)
+                     const std::vector<TopoDS_Face>& tools,
+                     const BooleanOptions&           options)
 {
-  return Section(shapes::FromFaces(arguments), shapes::FromFaces(tools));
+  return Section(shapes::FromFaces(arguments), shapes::FromFaces(tools), options);
 }
 
-TopoDS_Shape Section(const TopoDS_Face& arguments, const std::vector<TopoDS_Face>& tools)
+TopoDS_Shape Section(const TopoDS_Face&              arguments,
+                     const std::vector<TopoDS_Face>& tools,
+                     const BooleanOptions&           options)
 {
-  return Section({arguments}, shapes::FromFaces(tools));
+  return Section({arguments}, shapes::FromFaces(tools), options);
+}
+
+//------------------------------------------------------------------------------
+
+UnifyResult UnifySameDomain(const TopoDS_Shape& shape,
+                            bool                unifyFaces,
+                            bool                unifyEdges,
+                            double              linearTolerance,
+                            double              angularTolerance)
+{
+  if (shape.IsNull())
+  {
+    throw OCCInvalidArgumentException("UnifySameDomain shape must not be null!");
+  }
+  UnifyResult ret;
+  ret.facesBefore = CountDistinct(shape, TopAbs_FACE);
+  ret.edgesBefore = CountDistinct(shape, TopAbs_EDGE);
+
+  try
+  {
+    ShapeUpgrade_UnifySameDomain unifier(shape, unifyEdges, unifyFaces);
+    unifier.SetLinearTolerance(linearTolerance);
+    unifier.SetAngularTolerance(angularTolerance);
+    unifier.Build();
+    ret.shape = unifier.Shape();
+  }
+  catch (const Standard_Failure&)
+  {
+    return ret;
+  }
+
+  ret.facesAfter = CountDistinct(ret.shape, TopAbs_FACE);
+  ret.edgesAfter = CountDistinct(ret.shape, TopAbs_EDGE);
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
+TopoDS_Shape Perform(Operation                             operation,
+                     const NCollection_List<TopoDS_Shape>& arguments,
+                     const NCollection_List<TopoDS_Shape>& tools,
+                     const BooleanOptions&                 options,
+                     size_t*                               culledTools,
+                     const Message_ProgressRange&          progress)
+{
+  switch (operation)
+  {
+    case Operation::Fuse:
+      if (culledTools != nullptr)
+      {
+        *culledTools = 0;
+      }
+      return Fuse(arguments, tools, options, progress);
+    case Operation::Cut:
+      return Cut(arguments, tools, options, culledTools, progress);
+    case Operation::Common:
+      return Common(arguments, tools, options, culledTools, progress);
+    case Operation::Section:
+      return Section(arguments, tools, options, culledTools, progress);
+  }
+  return {};
+}
+
+//------------------------------------------------------------------------------
+
+ControlledResult Perform(Operation                             operation,
+                         const NCollection_List<TopoDS_Shape>& arguments,
+                         const NCollection_List<TopoDS_Shape>& tools,
+                         const ProgressControl&                control,
+                         const BooleanOptions&                 options)
+{
+  ControlledResult              ret;
+  occ::handle<ControlIndicator> indicator = new ControlIndicator(control);
+  try
+  {
+    ret.shape = Perform(operation, arguments, tools, options, nullptr, indicator->Start());
+  }
+  catch (const OCCInvalidArgumentException& e)
+  {
+    ret.status  = Status::InvalidArgument;
+    ret.error   = e.what();
+    ret.seconds = indicator->Elapsed();
+    return ret;
+  }
+  catch (const Standard_Failure& e)
+  {
+    ret.error = e.GetMessageString();
+  }
+  catch (const std::exception& e)
+  {
+    ret.error = e.what();
+  }
+
+  if (indicator->TimedOut())
+  {
+    ret.shape  = {};
+    ret.status = Status::TimedOut;
+    ret.error  = "Boolean operation exceeded its time budget";
+  }
+  else if (indicator->Cancelled())
+  {
+    ret.shape  = {};
+    ret.status = Status::Cancelled;
+    ret.error  = "Boolean operation was cancelled";
+  }
+  else if (ret.shape.IsNull())
+  {
+    ret.status = Status::Failed;
+    if (ret.error.empty())
+    {
+      ret.error = "Boolean operation failed";
+    }
+  }
+  else
+  {
+    ret.status = Status::Done;
+  }
+  ret.seconds = indicator->Elapsed();
+  return ret;
 }
 
 } // namespace occutils::boolean
@@ -0,0 +1,424 @@
+#include "occutils/occutils-bounding-box-broad-phase.h"
+
+// std includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// OCC includes
+#include <OSD_ThreadPool.hxx>
+#include <Standard_Failure.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::bbox
+{
+
+namespace
+{
+
+/**
+ * The minimum number of elements sorted or swept by one thread.
+ */
+constexpr size_t MinChunkSize = 2048;
+
+/**
+ * Sort() re-sorts by insertion if at most this many elements changed.
+ */
+constexpr size_t MaxInsertionSortChanges = 32;
+
+/**
+ * @return The number of chunks to split [count] items into, so that every
+ * thread gets some work but no chunk is tiny.
+ */
+size_t ChunkCount(size_t count, size_t maxThreads)
+{
+  const size_t poolThreads = static_cast<size_t>(OSD_ThreadPool::DefaultPool()->NbThreads());
+  const size_t threads     = maxThreads == 0 ? poolThreads : std::min(maxThreads, poolThreads);
+  return std::max<size_t>(1, std::min(threads, count / MinChunkSize));
+}
+
+/**
+ * Sort chunks of the values in parallel, then merge neighbouring chunks in
+ * parallel rounds.
+ */
+template <typename T, typename Less>
+void ParallelSort(std::vector<T>& values, const Less& less, size_t maxThreads)
+{
+  const size_t chunkCount = ChunkCount(values.size(), maxThreads);
+  if (chunkCount == 1)
+  {
+    std::sort(values.begin(), values.end(), less);
+    return;
+  }
+  const auto chunkBegin = [&](size_t chunk)
+  { return values.begin() + static_cast<std::ptrdiff_t>(values.size() * chunk / chunkCount); };
+
+  parallel::For(
+    0,
+    chunkCount,
+    [&](size_t chunk) { std::sort(chunkBegin(chunk), chunkBegin(chunk + 1), less); },
+    maxThreads);
+  for (size_t width = 1; width < chunkCount; width *= 2)
+  {
+    parallel::For(
+      0,
+      (chunkCount + 2 * width - 1) / (2 * width),
+      [&](size_t merge)
+      {
+        const size_t first  = 2 * width * merge;
+        const size_t middle = std::min(first + width, chunkCount);
+        const size_t last   = std::min(first + 2 * width, chunkCount);
+        std::inplace_merge(chunkBegin(first), chunkBegin(middle), chunkBegin(last), less);
+      },
+      maxThreads);
+  }
+}
+
+/**
+ * @return The minimum or maximum coordinates of the boxes along an axis.
+ */
+const std::vector<double>& MinAlong(const BoundingBoxArrays& boxes, int axis)
+{
+  return axis == 0 ? boxes.xMin : (axis == 1 ? boxes.yMin : boxes.zMin);
+}
+
+const std::vector<double>& MaxAlong(const BoundingBoxArrays& boxes, int axis)
+{
+  return axis == 0 ? boxes.xMax : (axis == 1 ? boxes.yMax : boxes.zMax);
+}
+
+} // namespace
+
+SweepAndPrune::SweepAndPrune(const std::vector<TopoDS_Shape>& shapes,
+                             Mode                             mode,
+                             size_t                           maxThreads)
+    : m_mode(mode),
+      m_maxThreads(maxThreads),
+      m_parts(shapes),
+      m_partOf(shapes.size()),
+      m_locations(shapes.size())
+{
+  for (size_t i = 0; i < shapes.size(); i++)
+  {
+    m_partOf[i] = i;
+  }
+  Build();
+}
+
+SweepAndPrune::SweepAndPrune(const std::vector<Instance>& instances,
+                             Mode                         mode,
+                             size_t                       maxThreads)
+    : m_mode(mode),
+      m_maxThreads(maxThreads),
+      m_partOf(instances.size()),
+      m_locations(instances.size())
+{
+  // Bound every part once, no matter how many instances it has
+  TopTools_IndexedMapOfShape parts;
+  std::vector<size_t>        partOfId; // Index of the part with ID i + 1 in m_parts
+  for (size_t i = 0; i < instances.size(); i++)
+  {
+    const Instance& instance = instances[i];
+    m_locations[i]           = instance.location;
+    if (instance.part.IsNull())
+    {
+      m_partOf[i] = m_parts.size();
+      m_parts.push_back(instance.part);
+      continue;
+    }
+    const size_t id = static_cast<size_t>(parts.Add(instance.part));
+    if (id > partOfId.size())
+    {
+      partOfId.push_back(m_parts.size());
+      m_parts.push_back(instance.part);
+    }
+    m_partOf[i] = partOfId[id - 1];
+  }
+  Build();
+}
+
+//------------------------------------------------------------------------------
+
+size_t SweepAndPrune::Size() const
+{
+  return m_partOf.size();
+}
+
+int SweepAndPrune::Axis() const
+{
+  return m_axis;
+}
+
+const BoundingBoxArrays& SweepAndPrune::Boxes() const
+{
+  return m_boxes;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::pair<size_t, size_t>> SweepAndPrune::Pairs() const
+{
+  const size_t count      = m_sorted.size();
+  const size_t chunkCount = ChunkCount(count, m_maxThreads);
+
+  std::vector<std::vector<std::pair<size_t, size_t>>> chunkPairs(chunkCount);
+  parallel::For(
+    0,
+    chunkCount,
+    [&](size_t chunk)
+    {
+      auto& pairs = chunkPairs[chunk];
+      for (size_t i = count * chunk / chunkCount; i < count * (chunk + 1) / chunkCount; i++)
+      {
+        const Interval& interval = m_sorted[i];
+        // Void intervals have max = -infinity and are sorted last
+        for (size_t j = i + 1; j < count && m_sorted[j].min <= interval.max; j++)
+        {
+          const size_t other = m_sorted[j].element;
+          if (Overlap(interval.element, other))
+          {
+            pairs.push_back(std::minmax(interval.element, other));
+          }
+        }
+      }
+    },
+    m_maxThreads);
+
+  std::vector<std::pair<size_t, size_t>> ret;
+  for (const auto& pairs : chunkPairs)
+  {
+    ret.insert(ret.end(), pairs.begin(), pairs.end());
+  }
+  std::sort(ret.begin(), ret.end());
+  return ret;
+}
+
+std::vector<std::pair<size_t, size_t>> SweepAndPrune::Pairs(
+  const std::vector<size_t>& elements) const
+{
+  const std::vector<double>& min = MinAlong(m_boxes, m_axis);
+  const std::vector<double>& max = MaxAlong(m_boxes, m_axis);
+
+  std::vector<std::pair<size_t, size_t>> ret;
+  for (size_t element : elements)
+  {
+    CheckElement(element);
+    if (min[element] > max[element])
+    {
+      continue; // Void box
+    }
+    // No interval starting before min - m_maxExtent can reach this one
+    auto it = std::lower_bound(m_sorted.begin(),
+                               m_sorted.end(),
+                               min[element] - m_maxExtent,
+                               [](const Interval& interval, double value)
+                               { return interval.min < value; });
+    for (; it != m_sorted.end() && it->min <= max[element]; ++it)
+    {
+      if (it->element != element && Overlap(element, it->element))
+      {
+        ret.push_back(std::minmax(element, it->element));
+      }
+    }
+  }
+  std::sort(ret.begin(), ret.end());
+  ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
+void SweepAndPrune::Move(size_t element, const TopLoc_Location& location)
+{
+  CheckElement(element);
+  m_locations[element] = location;
+  Place(element);
+  m_changed++;
+}
+
+void SweepAndPrune::Update(size_t element, const TopoDS_Shape& shape)
+{
+  CheckElement(element);
+  Bnd_Box box;
+  try
+  {
+    box = Compute(shape, m_mode).box;
+  }
+  catch (const Standard_Failure&)
+  {
+    // Treat like a part without geometry
+    box.SetVoid();
+  }
+
+  // Replace the part in place unless other instances share it
+  size_t&    part   = m_partOf[element];
+  const bool shared = std::count(m_partOf.begin(), m_partOf.end(), part) > 1;
+  if (shared)
+  {
+    part = m_parts.size();
+    m_parts.push_back(shape);
+    m_partBoxes.push_back(box);
+  }
+  else
+  {
+    m_parts[part]     = shape;
+    m_partBoxes[part] = box;
+  }
+  Place(element);
+  m_changed++;
+}
+
+void SweepAndPrune::Sort()
+{
+  const std::vector<double>& min = MinAlong(m_boxes, m_axis);
+  const std::vector<double>& max = MaxAlong(m_boxes, m_axis);
+
+  m_maxExtent = 0.0;
+  for (Interval& interval : m_sorted)
+  {
+    interval.min = min[interval.element];
+    interval.max = max[interval.element];
+    if (interval.min <= interval.max)
+    {
+      m_maxExtent = std::max(m_maxExtent, interval.max - interval.min);
+    }
+  }
+
+  const auto less = [](const Interval& a, const Interval& b)
+  { return a.min < b.min || (a.min == b.min && a.element < b.element); };
+  if (m_changed <= MaxInsertionSortChanges)
+  {
+    // Nearly sorted, so every interval only moves a few places
+    for (size_t i = 1; i < m_sorted.size(); i++)
+    {
+      const Interval interval = m_sorted[i];
+      size_t         j        = i;
+      for (; j > 0 && less(interval, m_sorted[j - 1]); j--)
+      {
+        m_sorted[j] = m_sorted[j - 1];
+      }
+      m_sorted[j] = interval;
+    }
+  }
+  else
+  {
+    ParallelSort(m_sorted, less, m_maxThreads);
+  }
+  m_changed = 0;
+}
+
+//------------------------------------------------------------------------------
+
+void SweepAndPrune::Build()
+{
+  m_partBoxes.assign(m_parts.size(), Bnd_Box());
+  parallel::For(
+    0,
+    m_parts.size(),
+    [this](size_t i)
+    {
+      try
+      {
+        m_partBoxes[i] = Compute(m_parts[i], m_mode).box;
+      }
+      catch (const Standard_Failure&)
+      {
+        // Treat like a part without geometry
+        m_partBoxes[i].SetVoid();
+      }
+    },
+    m_maxThreads);
+
+  const size_t count = m_partOf.size();
+  for (std::vector<double>* coordinates : {&m_boxes.xMin,
+                                           &m_boxes.yMin,
+                                           &m_boxes.zMin,
+                                           &m_boxes.xMax,
+                                           &m_boxes.yMax,
+                                           &m_boxes.zMax})
+  {
+    coordinates->resize(count);
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    Place(i);
+  }
+
+  // Sweep along the axis along which the box centers spread the most
+  double spread[3] = {0.0, 0.0, 0.0};
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const std::vector<double>& min = MinAlong(m_boxes, axis);
+    const std::vector<double>& max = MaxAlong(m_boxes, axis);
+
+    double sum        = 0.0;
+    double sumSquares = 0.0;
+    size_t n          = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+      const double center = 0.5 * (min[i] + max[i]);
+      if (min[i] <= max[i] && std::isfinite(center))
+      {
+        sum += center;
+        sumSquares += center * center;
+        n++;
+      }
+    }
+    spread[axis] = n == 0 ? 0.0 : sumSquares / n - (sum / n) * (sum / n);
+  }
+  m_axis = static_cast<int>(std::max_element(spread, spread + 3) - spread);
+
+  m_sorted.resize(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    m_sorted[i].element = i;
+  }
+  m_changed = count;
+  Sort();
+}
+
+void SweepAndPrune::Place(size_t element)
+{
+  const TopLoc_Location& location = m_locations[element];
+
+  Bnd_Box box = m_partBoxes[m_partOf[element]];
+  if (!location.IsIdentity())
+  {
+    box = box.Transformed(location.Transformation());
+  }
+  if (box.IsVoid())
+  {
+    const double infinity = std::numeric_limits<double>::infinity();
+    m_boxes.xMin[element] = m_boxes.yMin[element] = m_boxes.zMin[element] = infinity;
+    m_boxes.xMax[element] = m_boxes.yMax[element] = m_boxes.zMax[element] = -infinity;
+    return;
+  }
+  box.Get(m_boxes.xMin[element],
+          m_boxes.yMin[element],
+          m_boxes.zMin[element],
+          m_boxes.xMax[element],
+          m_boxes.yMax[element],
+          m_boxes.zMax[element]);
+}
+
+bool SweepAndPrune::Overlap(size_t first, size_t second) const
+{
+  const BoundingBoxArrays& b = m_boxes;
+  return b.xMin[first] <= b.xMax[second] && b.xMin[second] <= b.xMax[first]
+         && b.yMin[first] <= b.yMax[second] && b.yMin[second] <= b.yMax[first]
+         && b.zMin[first] <= b.zMax[second] && b.zMin[second] <= b.zMax[first];
+}
+
+void SweepAndPrune::CheckElement(size_t element) const
+{
+  if (element >= m_partOf.size())
+  {
+    throw OCCInvalidArgumentException("bbox::SweepAndPrune element out of range");
+  }
+}
+
+} // namespace occutils::bbox
@@ -0,0 +1,145 @@
+#include "occutils/occutils-bounding-box-cache.h"
+
+// std includes
+#include <cmath>
+
+// OCC includes
+#include <BRepBndLib.hxx>
+#include <TopoDS_Iterator.hxx>
+
+namespace occutils::bbox
+{
+
+Cache::Cache(size_t maxEntries) : m_maxEntries(maxEntries)
+{
+}
+
+Bnd_Box Cache::Box(const TopoDS_Shape& shape)
+{
+  Bnd_Box box;
+  if (shape.IsNull() || Lookup(shape, box))
+  {
+    return box;
+  }
+  const TopAbs_ShapeEnum type = shape.ShapeType();
+  if (type == TopAbs_COMPOUND || type == TopAbs_COMPSOLID)
+  {
+    // The iterator composes the location of the children with the one of the
+    // compound, so every child is cached at its absolute location
+    for (TopoDS_Iterator it(shape); it.More(); it.Next())
+    {
+      box.Add(Box(it.Value()));
+    }
+  }
+  else
+  {
+    BRepBndLib::Add(shape, box);
+  }
+  Insert(shape, box);
+  return box;
+}
+
+std::pair<gp_Vec, gp_Vec> Cache::BoundingBox(const TopoDS_Shape& shape)
+{
+  const Bnd_Box box = Box(shape);
+  return std::make_pair(gp_Vec(box.CornerMin().XYZ()), gp_Vec(box.CornerMax().XYZ()));
+}
+
+gp_XYZ Cache::Size(const TopoDS_Shape& shape)
+{
+  const Bnd_Box box = Box(shape);
+  const gp_XYZ  min = box.CornerMin().XYZ();
+  const gp_XYZ  max = box.CornerMax().XYZ();
+  return {std::abs(max.X() - min.X()), std::abs(max.Y() - min.Y()), std::abs(max.Z() - min.Z())};
+}
+
+double Cache::Volume(const TopoDS_Shape& shape)
+{
+  const gp_XYZ size = Size(shape);
+  return size.X() * size.Y() * size.Z();
+}
+
+void Cache::Invalidate(const TopoDS_Shape& shape)
+{
+  if (shape.IsNull())
+  {
+    return;
+  }
+  std::lock_guard lock(m_mutex);
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (it->shape.TShape() == shape.TShape())
+    {
+      m_index.UnBind(it->shape);
+      it = m_entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void Cache::Clear()
+{
+  std::lock_guard lock(m_mutex);
+  m_entries.clear();
+  m_index.Clear();
+}
+
+size_t Cache::Hits() const
+{
+  return m_hits;
+}
+
+size_t Cache::Misses() const
+{
+  return m_misses;
+}
+
+size_t Cache::Entries() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_entries.size();
+}
+
+bool Cache::Lookup(const TopoDS_Shape& shape, Bnd_Box& box)
+{
+  std::lock_guard lock(m_mutex);
+  const EntryIterator* entry = m_index.Seek(shape);
+  if (entry == nullptr)
+  {
+    m_misses++;
+    return false;
+  }
+  // Move to the front, i.e. mark as most recently used
+  m_entries.splice(m_entries.begin(), m_entries, *entry);
+  box = (*entry)->box;
+  m_hits++;
+  return true;
+}
+
+void Cache::Insert(const TopoDS_Shape& shape, const Bnd_Box& box)
+{
+  if (m_maxEntries == 0)
+  {
+    return;
+  }
+  std::lock_guard lock(m_mutex);
+  if (EntryIterator* entry = m_index.ChangeSeek(shape))
+  {
+    // Another thread was faster
+    (*entry)->box = box;
+    m_entries.splice(m_entries.begin(), m_entries, *entry);
+    return;
+  }
+  m_entries.push_front({shape, box});
+  m_index.Bind(shape, m_entries.begin());
+  while (m_entries.size() > m_maxEntries)
+  {
+    m_index.UnBind(m_entries.back().shape);
+    m_entries.pop_back();
+  }
+}
+
+} // namespace occutils::bbox
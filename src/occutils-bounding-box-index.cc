@@ -0,0 +1,524 @@
+#include "occutils/occutils-bounding-box-index.h"
+
+// std includes
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+// OCC includes
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::bbox
+{
+
+namespace
+{
+
+/**
+ * The maximum number of elements in a leaf of the tree.
+ */
+constexpr size_t LeafSize = 4;
+
+constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+} // namespace
+
+Index::Index(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, size_t maxThreads)
+{
+  TopTools_IndexedMapOfShape map;
+  TopExp::MapShapes(shape, type, map);
+  m_shapes.reserve(map.Extent());
+  for (int i = 1; i <= map.Extent(); i++)
+  {
+    m_shapes.push_back(map(i));
+  }
+  Build(maxThreads);
+}
+
+Index::Index(const std::vector<TopoDS_Shape>& shapes, size_t maxThreads) : m_shapes(shapes)
+{
+  Build(maxThreads);
+}
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+
+/**
+ * Convert a box, including its gap. Void boxes become inverted bounds, which
+ * overlap nothing.
+ */
+template <typename Bounds>
+Bounds BoundsOf(const Bnd_Box& box)
+{
+  Bounds bounds{{Infinity, Infinity, Infinity}, {-Infinity, -Infinity, -Infinity}};
+  if (!box.IsVoid())
+  {
+    box.Get(
+      bounds.min[0], bounds.min[1], bounds.min[2], bounds.max[0], bounds.max[1], bounds.max[2]);
+  }
+  return bounds;
+}
+
+template <typename Bounds>
+void Grow(Bounds& bounds, const Bounds& other)
+{
+  for (int axis = 0; axis < 3; axis++)
+  {
+    bounds.min[axis] = std::min(bounds.min[axis], other.min[axis]);
+    bounds.max[axis] = std::max(bounds.max[axis], other.max[axis]);
+  }
+}
+
+template <typename Bounds>
+bool Overlap(const Bounds& a, const Bounds& b)
+{
+  for (int axis = 0; axis < 3; axis++)
+  {
+    if (a.max[axis] < b.min[axis] || b.max[axis] < a.min[axis])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Distance between a point and a box, 0 if the point is inside.
+ */
+template <typename Bounds>
+double BoxDistance(const gp_Pnt& point, const Bounds& bounds)
+{
+  double squareDistance = 0.0;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const double coord = point.Coord(axis + 1);
+    const double delta = std::max({bounds.min[axis] - coord, 0.0, coord - bounds.max[axis]});
+    squareDistance += delta * delta;
+  }
+  return std::sqrt(squareDistance);
+}
+
+/**
+ * Slab test of a half-line against a box.
+ *
+ * @return false if the ray misses the box, else true and the ray parameter at
+ * which it enters the box (0 if it starts inside).
+ */
+template <typename Bounds>
+bool RayEnters(const gp_Ax1& ray, const Bounds& bounds, double& enter)
+{
+  double tMin = 0.0;
+  double tMax = Infinity;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const double origin    = ray.Location().Coord(axis + 1);
+    const double direction = ray.Direction().Coord(axis + 1);
+    if (direction == 0.0)
+    {
+      if (origin < bounds.min[axis] || origin > bounds.max[axis])
+      {
+        return false;
+      }
+      continue;
+    }
+    double t1 = (bounds.min[axis] - origin) / direction;
+    double t2 = (bounds.max[axis] - origin) / direction;
+    if (t1 > t2)
+    {
+      std::swap(t1, t2);
+    }
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax)
+    {
+      return false;
+    }
+  }
+  enter = tMin;
+  return true;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+void Index::Build(size_t maxThreads)
+{
+  const size_t count = m_shapes.size();
+  m_boxes.assign(count, Bnd_Box());
+  m_bounds.resize(count);
+  parallel::For(
+    0,
+    count,
+    [this](size_t i)
+    {
+      try
+      {
+        BRepBndLib::Add(m_shapes[i], m_boxes[i]);
+      }
+      catch (const Standard_Failure&)
+      {
+        // Treat like an element without geometry
+        m_boxes[i].SetVoid();
+      }
+      m_bounds[i] = BoundsOf<Bounds>(m_boxes[i]);
+    },
+    maxThreads);
+  BuildTree();
+}
+
+void Index::BuildTree()
+{
+  m_order.clear();
+  for (size_t i = 0; i < m_shapes.size(); i++)
+  {
+    if (!m_boxes[i].IsVoid())
+    {
+      m_order.push_back(i);
+    }
+  }
+  m_nodes.clear();
+  if (!m_order.empty())
+  {
+    m_nodes.reserve(2 * (m_order.size() / LeafSize + 1));
+    BuildNode(0, m_order.size());
+  }
+}
+
+int Index::BuildNode(size_t first, size_t last)
+{
+  const int nodeIndex = static_cast<int>(m_nodes.size());
+  m_nodes.emplace_back();
+
+  Bounds bounds  = BoundsOf<Bounds>(Bnd_Box());
+  Bounds centers = bounds;
+  for (size_t i = first; i < last; i++)
+  {
+    const Bounds& element = m_bounds[m_order[i]];
+    Grow(bounds, element);
+    for (int axis = 0; axis < 3; axis++)
+    {
+      const double center = 0.5 * (element.min[axis] + element.max[axis]);
+      centers.min[axis]   = std::min(centers.min[axis], center);
+      centers.max[axis]   = std::max(centers.max[axis], center);
+    }
+  }
+  m_nodes[nodeIndex].bounds = bounds;
+
+  if (last - first <= LeafSize)
+  {
+    m_nodes[nodeIndex].first = static_cast<int>(first);
+    m_nodes[nodeIndex].count = static_cast<int>(last - first);
+    return nodeIndex;
+  }
+
+  // Split at the median center along the widest axis of the centers
+  int axis = 0;
+  for (int candidate = 1; candidate < 3; candidate++)
+  {
+    if (centers.max[candidate] - centers.min[candidate] > centers.max[axis] - centers.min[axis])
+    {
+      axis = candidate;
+    }
+  }
+  const size_t mid = first + (last - first) / 2;
+  std::nth_element(m_order.begin() + first,
+                   m_order.begin() + mid,
+                   m_order.begin() + last,
+                   [this, axis](size_t a, size_t b)
+                   {
+                     return m_bounds[a].min[axis] + m_bounds[a].max[axis] <
+                            m_bounds[b].min[axis] + m_bounds[b].max[axis];
+                   });
+
+  // The left child directly follows its parent
+  BuildNode(first, mid);
+  const int right          = BuildNode(mid, last);
+  m_nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+//------------------------------------------------------------------------------
+
+size_t Index::Size() const
+{
+  return m_shapes.size();
+}
+
+const TopoDS_Shape& Index::Shape(size_t element) const
+{
+  if (element >= m_shapes.size())
+  {
+    throw OCCInvalidArgumentException("bbox::Index element out of range");
+  }
+  return m_shapes[element];
+}
+
+const Bnd_Box& Index::Box(size_t element) const
+{
+  if (element >= m_boxes.size())
+  {
+    throw OCCInvalidArgumentException("bbox::Index element out of range");
+  }
+  return m_boxes[element];
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<size_t> Index::Overlapping(const Bnd_Box& box) const
+{
+  std::vector<size_t> ret;
+  if (m_nodes.empty() || box.IsVoid())
+  {
+    return ret;
+  }
+  const Bounds query = BoundsOf<Bounds>(box);
+
+  std::vector<int> stack{0};
+  while (!stack.empty())
+  {
+    const Node& node = m_nodes[stack.back()];
+    const int   self = stack.back();
+    stack.pop_back();
+    if (!Overlap(node.bounds, query))
+    {
+      continue;
+    }
+    if (node.count > 0)
+    {
+      for (int i = node.first; i < node.first + node.count; i++)
+      {
+        if (Overlap(m_bounds[m_order[i]], query))
+        {
+          ret.push_back(m_order[i]);
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.right);
+    stack.push_back(self + 1);
+  }
+  std::sort(ret.begin(), ret.end());
+  return ret;
+}
+
+std::vector<size_t> Index::HitByRay(const gp_Ax1& ray) const
+{
+  std::vector<std::pair<double, size_t>> hits;
+  if (m_nodes.empty())
+  {
+    return {};
+  }
+
+  std::vector<int> stack{0};
+  double           enter = 0.0;
+  while (!stack.empty())
+  {
+    const int   self = stack.back();
+    const Node& node = m_nodes[self];
+    stack.pop_back();
+    if (!RayEnters(ray, node.bounds, enter))
+    {
+      continue;
+    }
+    if (node.count > 0)
+    {
+      for (int i = node.first; i < node.first + node.count; i++)
+      {
+        if (RayEnters(ray, m_bounds[m_order[i]], enter))
+        {
+          hits.emplace_back(enter, m_order[i]);
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.right);
+    stack.push_back(self + 1);
+  }
+
+  std::sort(hits.begin(), hits.end());
+  std::vector<size_t> ret;
+  ret.reserve(hits.size());
+  for (const auto& hit : hits)
+  {
+    ret.push_back(hit.second);
+  }
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
+double Index::Distance(const gp_Pnt& point, size_t element) const
+{
+  try
+  {
+    BRepExtrema_DistShapeShape extrema(BRepBuilderAPI_MakeVertex(point).Vertex(),
+                                       m_shapes[element]);
+    if (extrema.IsDone() && extrema.NbSolution() > 0)
+    {
+      return extrema.Value();
+    }
+  }
+  catch (const Standard_Failure&)
+  {
+    // Fall back to the box distance below
+  }
+  return BoxDistance(point, m_bounds[element]);
+}
+
+std::vector<std::pair<double, size_t>> Index::NearestWithDistances(const gp_Pnt& point,
+                                                                   size_t        k) const
+{
+  if (m_nodes.empty() || k == 0)
+  {
+    return {};
+  }
+
+  // Max-heap of the best elements found so far
+  std::priority_queue<std::pair<double, size_t>> best;
+  // Min-heap of nodes to visit, by their box distance
+  std::priority_queue<std::pair<double, int>,
+                      std::vector<std::pair<double, int>>,
+                      std::greater<std::pair<double, int>>>
+    queue;
+  queue.emplace(BoxDistance(point, m_nodes[0].bounds), 0);
+
+  const auto isPruned = [&best, k](double lowerBound)
+  { return best.size() == k && lowerBound >= best.top().first; };
+
+  while (!queue.empty())
+  {
+    const auto [lowerBound, self] = queue.top();
+    queue.pop();
+    if (isPruned(lowerBound))
+    {
+      break;
+    }
+    const Node& node = m_nodes[self];
+    if (node.count == 0)
+    {
+      queue.emplace(BoxDistance(point, m_nodes[self + 1].bounds), self + 1);
+      queue.emplace(BoxDistance(point, m_nodes[node.right].bounds), node.right);
+      continue;
+    }
+    for (int i = node.first; i < node.first + node.count; i++)
+    {
+      const size_t element = m_order[i];
+      if (isPruned(BoxDistance(point, m_bounds[element])))
+      {
+        continue;
+      }
+      const double distance = Distance(point, element);
+      if (best.size() < k)
+      {
+        best.emplace(distance, element);
+      }
+      else if (distance < best.top().first)
+      {
+        best.pop();
+        best.emplace(distance, element);
+      }
+    }
+  }
+
+  std::vector<std::pair<double, size_t>> ret(best.size());
+  for (size_t i = ret.size(); i > 0; i--)
+  {
+    ret[i - 1] = best.top();
+    best.pop();
+  }
+  return ret;
+}
+
+std::optional<size_t> Index::Nearest(const gp_Pnt& point, double* distance) const
+{
+  const auto nearest = NearestWithDistances(point, 1);
+  if (nearest.empty())
+  {
+    return std::nullopt;
+  }
+  if (distance != nullptr)
+  {
+    *distance = nearest[0].first;
+  }
+  return nearest[0].second;
+}
+
+std::vector<size_t> Index::KNearest(const gp_Pnt& point, size_t k) const
+{
+  std::vector<size_t> ret;
+  for (const auto& [distance, element] : NearestWithDistances(point, k))
+  {
+    ret.push_back(element);
+  }
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
+void Index::Update(size_t element, const TopoDS_Shape& shape)
+{
+  if (element >= m_shapes.size())
+  {
+    throw OCCInvalidArgumentException("bbox::Index element out of range");
+  }
+  const bool wasVoid = m_boxes[element].IsVoid();
+  m_shapes[element]  = shape;
+  m_boxes[element].SetVoid();
+  try
+  {
+    BRepBndLib::Add(shape, m_boxes[element]);
+  }
+  catch (const Standard_Failure&)
+  {
+    // Treat like an element without geometry
+    m_boxes[element].SetVoid();
+  }
+  m_bounds[element] = BoundsOf<Bounds>(m_boxes[element]);
+
+  // Elements without geometry are not part of the tree, so the tree cannot
+  // be refit when an element gains or loses its geometry
+  if (m_boxes[element].IsVoid() != wasVoid)
+  {
+    BuildTree();
+  }
+}
+
+void Index::Refit()
+{
+  // Children always follow their parent, so a reverse sweep visits them first
+  for (size_t i = m_nodes.size(); i > 0; i--)
+  {
+    const int self   = static_cast<int>(i - 1);
+    Node&     node   = m_nodes[self];
+    Bounds    bounds = BoundsOf<Bounds>(Bnd_Box());
+    if (node.count > 0)
+    {
+      for (int j = node.first; j < node.first + node.count; j++)
+      {
+        Grow(bounds, m_bounds[m_order[j]]);
+      }
+    }
+    else
+    {
+      Grow(bounds, m_nodes[self + 1].bounds);
+      Grow(bounds, m_nodes[node.right].bounds);
+    }
+    node.bounds = bounds;
+  }
+}
+
+} // namespace occutils::bbox
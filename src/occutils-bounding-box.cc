@@ -1,13 +1,23 @@
 #include "occutils/occutils-bounding-box.h"
 
 // std includes
+#include <cmath>
+#include <limits>
 #include <set>
 #include <vector>
 
 // OCC includes
 #include <BRepBndLib.hxx>
+#include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <Bnd_OBB.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Vec.hxx>
 #include <gp_XYZ.hxx>
@@ -15,12 +25,118 @@
 // occutils includes
 #include "occutils/occutils-edge.h"
 #include "occutils/occutils-face.h"
+#include "occutils/occutils-parallel.h"
 #include "occutils/occutils-point.h"
 #include "occutils/occutils-primitive.h"
 
 namespace occutils::bbox
 {
 
+namespace
+{
+
+/**
+ * Add the nodes of the face triangulations, of the 3D polygons of the free
+ * edges and the free vertices of the shape to the box, each enlarged by its
+ * tolerance.
+ *
+ * @return false if a face has no triangulation or a free edge has no 3D
+ * polygon. The box is incomplete in that case.
+ */
+bool AddTriangulations(const TopoDS_Shape& shape, Bnd_Box& box)
+{
+  for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    const TopoDS_Face& face = TopoDS::Face(exp.Current());
+    TopLoc_Location    location;
+
+    const occ::handle<Poly_Triangulation>& triangulation = BRep_Tool::Triangulation(face, location);
+    if (triangulation.IsNull())
+    {
+      return false;
+    }
+    const gp_Trsf& trsf = location.Transformation();
+    for (int i = 1; i <= triangulation->NbNodes(); i++)
+    {
+      box.Add(triangulation->Node(i).Transformed(trsf));
+    }
+    box.Enlarge(BRep_Tool::Tolerance(face));
+  }
+  for (TopExp_Explorer exp(shape, TopAbs_EDGE, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    const TopoDS_Edge& edge = TopoDS::Edge(exp.Current());
+    TopLoc_Location    location;
+
+    const occ::handle<Poly_Polygon3D>& polygon = BRep_Tool::Polygon3D(edge, location);
+    if (polygon.IsNull())
+    {
+      return false;
+    }
+    const gp_Trsf&            trsf  = location.Transformation();
+    const TColgp_Array1OfPnt& nodes = polygon->Nodes();
+    for (int i = nodes.Lower(); i <= nodes.Upper(); i++)
+    {
+      box.Add(nodes(i).Transformed(trsf));
+    }
+    box.Enlarge(BRep_Tool::Tolerance(edge));
+  }
+  for (TopExp_Explorer exp(shape, TopAbs_VERTEX, TopAbs_EDGE); exp.More(); exp.Next())
+  {
+    const TopoDS_Vertex& vertex = TopoDS::Vertex(exp.Current());
+    box.Add(BRep_Tool::Pnt(vertex));
+    box.Enlarge(BRep_Tool::Tolerance(vertex));
+  }
+  return true;
+}
+
+/**
+ * BRepBndLib::AddOptimal() on the exact geometry, enlarged by the shape
+ * tolerances, bounding the distinct faces of the shape in parallel.
+ */
+void AddOptimalParallel(const TopoDS_Shape& shape, Bnd_Box& box)
+{
+  TopTools_IndexedMapOfShape faces;
+  TopExp::MapShapes(shape, TopAbs_FACE, faces);
+
+  std::vector<Bnd_Box> faceBoxes(faces.Extent());
+  std::vector<char>    failed(faces.Extent(), 0);
+  parallel::For(0,
+                faceBoxes.size(),
+                [&](size_t i)
+                {
+                  const TopoDS_Shape& face = faces(static_cast<int>(i) + 1);
+                  try
+                  {
+                    BRepBndLib::AddOptimal(face, faceBoxes[i], false, true);
+                  }
+                  catch (const Standard_Failure&)
+                  {
+                    failed[i] = 1;
+                  }
+                });
+  for (size_t i = 0; i < faceBoxes.size(); i++)
+  {
+    if (failed[i])
+    {
+      // Retry in the calling thread, so the exception reaches the caller
+      faceBoxes[i].SetVoid();
+      BRepBndLib::AddOptimal(faces(static_cast<int>(i) + 1), faceBoxes[i], false, true);
+    }
+    box.Add(faceBoxes[i]);
+  }
+  // Edges and vertices that are not part of a face
+  for (TopExp_Explorer exp(shape, TopAbs_EDGE, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    BRepBndLib::AddOptimal(exp.Current(), box, false, true);
+  }
+  for (TopExp_Explorer exp(shape, TopAbs_VERTEX, TopAbs_EDGE); exp.More(); exp.Next())
+  {
+    BRepBndLib::AddOptimal(exp.Current(), box, false, true);
+  }
+}
+
+} // namespace
+
 std::pair<gp_Vec, gp_Vec> BoundingBox(const TopoDS_Shape& shape)
 {
   double xMin;
@@ -39,7 +155,7 @@ std::pair<gp_Vec, gp_Vec> BoundingBox(const TopoDS_Shape& shape)
 
 //------------------------------------------------------------------------------
 
-gp_XYZ BoundingBoxSize(const TopoDS_Shape& shape)
+gp_XYZ Size(const TopoDS_Shape& shape)
 {
   double xMin;
   double xMax;
@@ -52,19 +168,125 @@ gp_XYZ BoundingBoxSize(const TopoDS_Shape& shape)
   BRepBndLib::Add(shape, box);
   box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
 
-  return {abs(xMax - xMin), abs(yMax - yMin), abs(zMax - zMin)};
+  return {std::abs(xMax - xMin), std::abs(yMax - yMin), std::abs(zMax - zMin)};
 }
 
 //------------------------------------------------------------------------------
 
-double BoundingBoxVolume(const TopoDS_Shape& shape)
+double Volume(const TopoDS_Shape& shape)
 {
-  const gp_XYZ bbox = BoundingBoxSize(shape);
+  const gp_XYZ bbox = Size(shape);
   return bbox.X() * bbox.Y() * bbox.Z();
 }
 
 //------------------------------------------------------------------------------
 
+gp_XYZ BoundingBoxResult::Size() const
+{
+  if (mode == Mode::Oriented)
+  {
+    return obb.IsVoid() ? gp_XYZ() : 2 * gp_XYZ(obb.XHSize(), obb.YHSize(), obb.ZHSize());
+  }
+  if (box.IsVoid())
+  {
+    return {};
+  }
+  return box.CornerMax().XYZ() - box.CornerMin().XYZ();
+}
+
+double BoundingBoxResult::Volume() const
+{
+  const gp_XYZ size = Size();
+  return size.X() * size.Y() * size.Z();
+}
+
+BoundingBoxResult Compute(const TopoDS_Shape& shape, Mode mode, bool parallel)
+{
+  BoundingBoxResult ret;
+  ret.mode = mode;
+  switch (mode)
+  {
+    case Mode::Fast:
+      if (AddTriangulations(shape, ret.box))
+      {
+        break;
+      }
+      ret.mode = Mode::Default;
+      ret.box.SetVoid();
+      [[fallthrough]];
+    case Mode::Default:
+      BRepBndLib::Add(shape, ret.box);
+      break;
+    case Mode::Optimal:
+      if (parallel)
+      {
+        AddOptimalParallel(shape, ret.box);
+      }
+      else
+      {
+        BRepBndLib::AddOptimal(shape, ret.box, false, true);
+      }
+      break;
+    case Mode::Oriented:
+      BRepBndLib::AddOBB(shape, ret.obb);
+      if (!ret.obb.IsVoid())
+      {
+        gp_Pnt corners[8];
+        ret.obb.GetVertex(corners);
+        for (const gp_Pnt& corner : corners)
+        {
+          ret.box.Add(corner);
+        }
+      }
+      return ret;
+  }
+  if (!ret.box.IsVoid())
+  {
+    ret.obb = Bnd_OBB(ret.box);
+  }
+  return ret;
+}
+
+BoundingBoxArrays BoundingBoxes(const std::vector<TopoDS_Shape>& shapes,
+                                Mode                             mode,
+                                size_t                           maxThreads)
+{
+  const size_t      count    = shapes.size();
+  const double      infinity = std::numeric_limits<double>::infinity();
+  BoundingBoxArrays ret;
+  ret.xMin.assign(count, infinity);
+  ret.yMin.assign(count, infinity);
+  ret.zMin.assign(count, infinity);
+  ret.xMax.assign(count, -infinity);
+  ret.yMax.assign(count, -infinity);
+  ret.zMax.assign(count, -infinity);
+
+  parallel::For(
+    0,
+    count,
+    [&](size_t i)
+    {
+      Bnd_Box box;
+      try
+      {
+        box = Compute(shapes[i], mode).box;
+      }
+      catch (const Standard_Failure&)
+      {
+        // Treat like a shape without geometry
+        return;
+      }
+      if (!box.IsVoid())
+      {
+        box.Get(ret.xMin[i], ret.yMin[i], ret.zMin[i], ret.xMax[i], ret.yMax[i], ret.zMax[i]);
+      }
+    },
+    maxThreads);
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+
 bool Is1D(const Bnd_Box& bbox, double tolerance)
 {
   const bool xFlat = bbox.IsXThin(tolerance);
@@ -0,0 +1,201 @@
+#include "occutils/occutils-face-table.h"
+
+// std includes
+#include <limits>
+
+// OCC includes
+#include <BRepGProp.hxx>
+#include <BRepTools.hxx>
+#include <GProp_GProps.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::surfaces
+{
+
+FaceTable::FaceTable(const TopoDS_Shape& shape, size_t maxThreads)
+{
+  TopTools_IndexedMapOfShape map;
+  TopExp::MapShapes(shape, TopAbs_FACE, map);
+  m_faces.reserve(map.Extent());
+  for (int i = 1; i <= map.Extent(); i++)
+  {
+    m_faces.push_back(TopoDS::Face(map(i)));
+  }
+  Build(maxThreads);
+}
+
+FaceTable::FaceTable(const std::vector<TopoDS_Face>& faces, size_t maxThreads)
+    : m_faces(faces)
+{
+  Build(maxThreads);
+}
+
+//------------------------------------------------------------------------------
+
+size_t FaceTable::Size() const
+{
+  return m_faces.size();
+}
+
+const TopoDS_Face& FaceTable::Face(size_t row) const
+{
+  CheckRow(row);
+  return m_faces[row];
+}
+
+const GeomAdaptor_Surface& FaceTable::Surface(size_t row) const
+{
+  CheckRow(row);
+  return m_surfaces[row];
+}
+
+bool FaceTable::HasSurface(size_t row) const
+{
+  return !Surface(row).Surface().IsNull();
+}
+
+GeomAbs_SurfaceType FaceTable::Type(size_t row) const
+{
+  CheckRow(row);
+  return m_types[row];
+}
+
+double FaceTable::Area(size_t row) const
+{
+  CheckRow(row);
+  return m_areas[row];
+}
+
+gp_Pnt FaceTable::CenterOfMass(size_t row) const
+{
+  CheckRow(row);
+  return {m_centerX[row], m_centerY[row], m_centerZ[row]};
+}
+
+std::pair<gp_XY, gp_XY> FaceTable::UVBounds(size_t row) const
+{
+  CheckRow(row);
+  return std::make_pair(gp_XY(m_uMin[row], m_vMin[row]), gp_XY(m_uMax[row], m_vMax[row]));
+}
+
+TopAbs_Orientation FaceTable::Orientation(size_t row) const
+{
+  CheckRow(row);
+  return m_orientations[row];
+}
+
+const std::vector<TopoDS_Face>& FaceTable::Faces() const
+{
+  return m_faces;
+}
+
+const std::vector<GeomAbs_SurfaceType>& FaceTable::Types() const
+{
+  return m_types;
+}
+
+const std::vector<double>& FaceTable::Areas() const
+{
+  return m_areas;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<size_t> FaceTable::Only(GeomAbs_SurfaceType type) const
+{
+  return Filter([&](size_t row) { return m_types[row] == type && HasSurface(row); });
+}
+
+std::vector<SurfaceInfo> FaceTable::SurfaceInfos(const std::vector<size_t>& rows) const
+{
+  std::vector<SurfaceInfo> ret;
+  ret.reserve(rows.size());
+  for (size_t row : rows)
+  {
+    if (HasSurface(row))
+    {
+      ret.push_back({m_faces[row], m_surfaces[row]});
+    }
+  }
+  return ret;
+}
+
+SurfaceTypeStats FaceTable::Statistics() const
+{
+  SurfaceTypeStats stats;
+  for (size_t row = 0; row < Size(); row++)
+  {
+    if (HasSurface(row))
+    {
+      stats.Add(m_types[row]);
+    }
+  }
+  return stats;
+}
+
+//------------------------------------------------------------------------------
+
+void FaceTable::Build(size_t maxThreads)
+{
+  const size_t count = m_faces.size();
+  const double nan   = std::numeric_limits<double>::quiet_NaN();
+  m_surfaces.resize(count);
+  m_types.assign(count, GeomAbs_OtherSurface);
+  m_areas.assign(count, 0.0);
+  for (std::vector<double>* column :
+       {&m_centerX, &m_centerY, &m_centerZ, &m_uMin, &m_uMax, &m_vMin, &m_vMax})
+  {
+    column->assign(count, nan);
+  }
+  m_orientations.resize(count);
+
+  parallel::For(
+    0,
+    count,
+    [this](size_t row)
+    {
+      const TopoDS_Face& face = m_faces[row];
+      m_orientations[row]     = face.Orientation();
+      try
+      {
+        m_surfaces[row] = surface::FromFace(face);
+        if (!m_surfaces[row].Surface().IsNull())
+        {
+          m_types[row] = m_surfaces[row].GetType();
+        }
+
+        // Area and center of mass from one pass, see surface::AreaAndCenterOfMass()
+        GProp_GProps gprops;
+        BRepGProp::SurfaceProperties(face, gprops);
+        const gp_Pnt center = gprops.CentreOfMass();
+        m_areas[row]        = gprops.Mass();
+        m_centerX[row]      = center.X();
+        m_centerY[row]      = center.Y();
+        m_centerZ[row]      = center.Z();
+
+        BRepTools::UVBounds(face, m_uMin[row], m_uMax[row], m_vMin[row], m_vMax[row]);
+      }
+      catch (const Standard_Failure&)
+      {
+        // Keep the defaults of the properties that failed
+      }
+    },
+    maxThreads);
+}
+
+void FaceTable::CheckRow(size_t row) const
+{
+  if (row >= m_faces.size())
+  {
+    throw OCCInvalidArgumentException("surfaces::FaceTable row out of range");
+  }
+}
+
+} // namespace occutils::surfaces
@@ -66,6 +66,34 @@ std::optional<gp_Dir> NormalDirection(const TopoDS_Face& face,
   return surface::NormalDirection(surface, u, v, precision);
 }
 
+std::optional<gp_Ax1> Normal(const TopoDS_Face&     face,
+                             surface::AdaptorCache& cache,
+                             const double           u,
+                             const double           v,
+                             const double           precision)
+{
+  const GeomAdaptor_Surface& surface = cache.Get(face);
+  if (surface.Surface().IsNull())
+  {
+    return std::nullopt;
+  }
+  return surface::Normal(surface, u, v, precision);
+}
+
+std::optional<gp_Dir> NormalDirection(const TopoDS_Face&     face,
+                                      surface::AdaptorCache& cache,
+                                      const double           u,
+                                      const double           v,
+                                      const double           precision)
+{
+  const GeomAdaptor_Surface& surface = cache.Get(face);
+  if (surface.Surface().IsNull())
+  {
+    return std::nullopt;
+  }
+  return surface::NormalDirection(surface, u, v, precision);
+}
+
 TopoDS_Face FromPoints(const std::vector<gp_Pnt>& points)
 {
   return FromWire(wire::FromPoints(points, true));
@@ -1,12 +1,14 @@
 #include "occutils/occutils-shape-components.h"
 
 // std includes
+#include <numeric>
 #include <optional>
 #include <vector>
 
 // OCC includes
 #include <BRep_Tool.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_MapOfShape.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
@@ -19,19 +21,21 @@
 
 // occutils includes
 #include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
 #include "occutils/occutils-shape.h"
 
 namespace occutils::shape_components
 {
 
-std::vector<TopoDS_Solid> AllSolidsWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Solid> AllSolidsWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Solid> solids;
+  TopTools_MapOfShape       seen;
   for (TopExp_Explorer solidExplorer(shape, TopAbs_SOLID); solidExplorer.More();
        solidExplorer.Next())
   {
     const auto& solid = TopoDS::Solid(solidExplorer.Current());
-    if (solid.IsNull())
+    if (solid.IsNull() || (unique && !seen.Add(solid)))
     {
       continue;
     }
@@ -40,16 +44,17 @@ std::vector<TopoDS_Solid> AllSolidsWithin(const TopoDS_Shape& shape)
   return solids;
 }
 
-std::vector<TopoDS_Solid> AllSolidsWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Solid> AllSolidsWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Solid> solids;
+  TopTools_MapOfShape       seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer solidExplorer(shape, TopAbs_SOLID); solidExplorer.More();
          solidExplorer.Next())
     {
       const auto& solid = TopoDS::Solid(solidExplorer.Current());
-      if (solid.IsNull())
+      if (solid.IsNull() || (unique && !seen.Add(solid)))
       {
         continue;
       }
@@ -59,16 +64,22 @@ std::vector<TopoDS_Solid> AllSolidsWithin(const std::vector<TopoDS_Shape>& shape
   return solids;
 }
 
+std::vector<TopoDS_Solid> AllSolidsWithin(const TopologyIndex& index)
+{
+  return index.Solids();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<TopoDS_Shell> AllShellsWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Shell> AllShellsWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Shell> shells;
+  TopTools_MapOfShape       seen;
   for (TopExp_Explorer shellExplorer(shape, TopAbs_SHELL); shellExplorer.More();
        shellExplorer.Next())
   {
     const auto& shell = TopoDS::Shell(shellExplorer.Current());
-    if (shell.IsNull())
+    if (shell.IsNull() || (unique && !seen.Add(shell)))
     {
       continue;
     }
@@ -77,16 +88,17 @@ std::vector<TopoDS_Shell> AllShellsWithin(const TopoDS_Shape& shape)
   return shells;
 }
 
-std::vector<TopoDS_Shell> AllShellsWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Shell> AllShellsWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Shell> shells;
+  TopTools_MapOfShape       seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer shellExplorer(shape, TopAbs_SHELL); shellExplorer.More();
          shellExplorer.Next())
     {
       const auto& shell = TopoDS::Shell(shellExplorer.Current());
-      if (shell.IsNull())
+      if (shell.IsNull() || (unique && !seen.Add(shell)))
       {
         continue;
       }
@@ -96,15 +108,21 @@ std::vector<TopoDS_Shell> AllShellsWithin(const std::vector<TopoDS_Shape>& shape
   return shells;
 }
 
+std::vector<TopoDS_Shell> AllShellsWithin(const TopologyIndex& index)
+{
+  return index.Shells();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<TopoDS_Face> AllFacesWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Face> AllFacesWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Face> faces;
+  TopTools_MapOfShape      seen;
   for (TopExp_Explorer faceExplorer(shape, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next())
   {
     const auto& face = TopoDS::Face(faceExplorer.Current());
-    if (face.IsNull())
+    if (face.IsNull() || (unique && !seen.Add(face)))
     {
       continue;
     }
@@ -113,15 +131,16 @@ std::vector<TopoDS_Face> AllFacesWithin(const TopoDS_Shape& shape)
   return faces;
 }
 
-std::vector<TopoDS_Face> AllFacesWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Face> AllFacesWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Face> faces;
+  TopTools_MapOfShape      seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer faceExplorer(shape, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next())
     {
       const auto& face = TopoDS::Face(faceExplorer.Current());
-      if (face.IsNull())
+      if (face.IsNull() || (unique && !seen.Add(face)))
       {
         continue;
       }
@@ -131,15 +150,21 @@ std::vector<TopoDS_Face> AllFacesWithin(const std::vector<TopoDS_Shape>& shapes)
   return faces;
 }
 
+std::vector<TopoDS_Face> AllFacesWithin(const TopologyIndex& index)
+{
+  return index.Faces();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<TopoDS_Edge> AllEdgesWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Edge> AllEdgesWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Edge> edges;
+  TopTools_MapOfShape      seen;
   for (TopExp_Explorer edgeExplorer(shape, TopAbs_EDGE); edgeExplorer.More(); edgeExplorer.Next())
   {
     const auto& edge = TopoDS::Edge(edgeExplorer.Current());
-    if (edge.IsNull())
+    if (edge.IsNull() || (unique && !seen.Add(edge)))
     {
       continue;
     }
@@ -148,15 +173,16 @@ std::vector<TopoDS_Edge> AllEdgesWithin(const TopoDS_Shape& shape)
   return edges;
 }
 
-std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Edge> edges;
+  TopTools_MapOfShape      seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer edgeExplorer(shape, TopAbs_EDGE); edgeExplorer.More(); edgeExplorer.Next())
     {
       const auto& edge = TopoDS::Edge(edgeExplorer.Current());
-      if (edge.IsNull())
+      if (edge.IsNull() || (unique && !seen.Add(edge)))
       {
         continue;
       }
@@ -166,15 +192,16 @@ std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Shape>& shapes)
   return edges;
 }
 
-std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Wire>& shapes)
+std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Wire>& shapes, bool unique)
 {
   std::vector<TopoDS_Edge> edges;
+  TopTools_MapOfShape      seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer edgeExplorer(shape, TopAbs_EDGE); edgeExplorer.More(); edgeExplorer.Next())
     {
       const auto& edge = TopoDS::Edge(edgeExplorer.Current());
-      if (edge.IsNull())
+      if (edge.IsNull() || (unique && !seen.Add(edge)))
       {
         continue;
       }
@@ -184,15 +211,21 @@ std::vector<TopoDS_Edge> AllEdgesWithin(const std::vector<TopoDS_Wire>& shapes)
   return edges;
 }
 
+std::vector<TopoDS_Edge> AllEdgesWithin(const TopologyIndex& index)
+{
+  return index.Edges();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<TopoDS_Wire> AllWiresWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Wire> AllWiresWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Wire> wires;
+  TopTools_MapOfShape      seen;
   for (TopExp_Explorer wireExplorer(shape, TopAbs_WIRE); wireExplorer.More(); wireExplorer.Next())
   {
     const auto& wire = TopoDS::Wire(wireExplorer.Current());
-    if (wire.IsNull())
+    if (wire.IsNull() || (unique && !seen.Add(wire)))
     {
       continue;
     }
@@ -201,15 +234,16 @@ std::vector<TopoDS_Wire> AllWiresWithin(const TopoDS_Shape& shape)
   return wires;
 }
 
-std::vector<TopoDS_Wire> AllWiresWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Wire> AllWiresWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Wire> wires;
+  TopTools_MapOfShape      seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer wireExplorer(shape, TopAbs_WIRE); wireExplorer.More(); wireExplorer.Next())
     {
       const auto& wire = TopoDS::Wire(wireExplorer.Current());
-      if (wire.IsNull())
+      if (wire.IsNull() || (unique && !seen.Add(wire)))
       {
         continue;
       }
@@ -219,16 +253,22 @@ std::vector<TopoDS_Wire> AllWiresWithin(const std::vector<TopoDS_Shape>& shapes)
   return wires;
 }
 
+std::vector<TopoDS_Wire> AllWiresWithin(const TopologyIndex& index)
+{
+  return index.Wires();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<TopoDS_Vertex> AllVerticesWithin(const TopoDS_Shape& shape)
+std::vector<TopoDS_Vertex> AllVerticesWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<TopoDS_Vertex> wires;
+  TopTools_MapOfShape        seen;
   for (TopExp_Explorer vertexExplorer(shape, TopAbs_VERTEX); vertexExplorer.More();
        vertexExplorer.Next())
   {
     const auto& vertex = TopoDS::Vertex(vertexExplorer.Current());
-    if (vertex.IsNull())
+    if (vertex.IsNull() || (unique && !seen.Add(vertex)))
     {
       continue;
     }
@@ -237,16 +277,17 @@ std::vector<TopoDS_Vertex> AllVerticesWithin(const TopoDS_Shape& shape)
   return wires;
 }
 
-std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<TopoDS_Vertex> wires;
+  TopTools_MapOfShape        seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer vertexExplorer(shape, TopAbs_VERTEX); vertexExplorer.More();
          vertexExplorer.Next())
     {
       const auto& vertex = TopoDS::Vertex(vertexExplorer.Current());
-      if (vertex.IsNull())
+      if (vertex.IsNull() || (unique && !seen.Add(vertex)))
       {
         continue;
       }
@@ -256,16 +297,22 @@ std::vector<TopoDS_Vertex> AllVerticesWithin(const std::vector<TopoDS_Shape>& sh
   return wires;
 }
 
+std::vector<TopoDS_Vertex> AllVerticesWithin(const TopologyIndex& index)
+{
+  return index.Vertices();
+}
+
 //------------------------------------------------------------------------------
 
-std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopoDS_Shape& shape)
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopoDS_Shape& shape, bool unique)
 {
   std::vector<gp_Pnt> vertices;
+  TopTools_MapOfShape seen;
   for (TopExp_Explorer vertexExplorer(shape, TopAbs_VERTEX); vertexExplorer.More();
        vertexExplorer.Next())
   {
     const auto& vertex = TopoDS::Vertex(vertexExplorer.Current());
-    if (vertex.IsNull())
+    if (vertex.IsNull() || (unique && !seen.Add(vertex)))
     {
       continue;
     }
@@ -274,16 +321,17 @@ std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopoDS_Shape& shape)
   return vertices;
 }
 
-std::vector<gp_Pnt> AllVertexCoordinatesWithin(const std::vector<TopoDS_Shape>& shapes)
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const std::vector<TopoDS_Shape>& shapes, bool unique)
 {
   std::vector<gp_Pnt> vertices;
+  TopTools_MapOfShape seen;
   for (const auto& shape : shapes)
   {
     for (TopExp_Explorer vertexExplorer(shape, TopAbs_VERTEX); vertexExplorer.More();
          vertexExplorer.Next())
     {
       const auto& vertex = TopoDS::Vertex(vertexExplorer.Current());
-      if (vertex.IsNull())
+      if (vertex.IsNull() || (unique && !seen.Add(vertex)))
       {
         continue;
       }
@@ -293,25 +341,54 @@ std::vector<gp_Pnt> AllVertexCoordinatesWithin(const std::vector<TopoDS_Shape>&
   return vertices;
 }
 
+std::vector<gp_Pnt> AllVertexCoordinatesWithin(const TopologyIndex& index)
+{
+  std::vector<gp_Pnt> vertices;
+  vertices.reserve(index.Vertices().size());
+  for (const auto& vertex : index.Vertices())
+  {
+    vertices.push_back(BRep_Tool::Pnt(vertex));
+  }
+  return vertices;
+}
+
 //------------------------------------------------------------------------------
 
-std::optional<TopoDS_Solid> TryGetSingleSolid(const TopoDS_Shape& shape, bool firstOfMultipleOK)
+namespace
 {
-  // Is shape itself a solid?
-  if (shape::IsSolid(shape))
-    return TopoDS::Solid(shape);
 
-  // Else, expect there to be ONE sub-solid
-  auto solids = shape_components::AllSolidsWithin(shape);
-  if (solids.empty())
+/**
+ * Get the first sub-shape of type T within shape. If [firstOfMultipleOK] is
+ * false, the traversal continues up to the second hit (but no further) to
+ * reject shapes with several sub-shapes of type T.
+ */
+template <typename T>
+std::optional<T> TryGetSingle(const TopoDS_Shape& shape, bool firstOfMultipleOK)
+{
+  const SubShapeRange<T> range(shape);
+  auto                   it = range.begin();
+  if (it == range.end())
   {
     return std::nullopt;
   }
-  if (solids.size() > 1 && !firstOfMultipleOK)
+  T first = *it;
+  if (!firstOfMultipleOK && ++it != range.end())
   {
     return std::nullopt;
   }
-  return solids[0];
+  return first;
+}
+
+} // namespace
+
+std::optional<TopoDS_Solid> TryGetSingleSolid(const TopoDS_Shape& shape, bool firstOfMultipleOK)
+{
+  // Is shape itself a solid?
+  if (shape::IsSolid(shape))
+    return TopoDS::Solid(shape);
+
+  // Else, expect there to be ONE sub-solid
+  return TryGetSingle<TopoDS_Solid>(shape, firstOfMultipleOK);
 }
 
 std::optional<TopoDS_Shell> TryGetSingleShell(const TopoDS_Shape& shape, bool firstOfMultipleOK)
@@ -321,16 +398,7 @@ std::optional<TopoDS_Shell> TryGetSingleShell(const TopoDS_Shape& shape, bool fi
     return TopoDS::Shell(shape);
 
   // Else, expect there to be ONE sub-solid
-  auto shells = shape_components::AllShellsWithin(shape);
-  if (shells.empty())
-  {
-    return std::nullopt;
-  }
-  if (shells.size() > 1 && !firstOfMultipleOK)
-  {
-    return std::nullopt;
-  }
-  return shells[0];
+  return TryGetSingle<TopoDS_Shell>(shape, firstOfMultipleOK);
 }
 
 std::optional<TopoDS_Face> TryGetSingleFace(const TopoDS_Shape& shape, bool firstOfMultipleOK)
@@ -340,16 +408,7 @@ std::optional<TopoDS_Face> TryGetSingleFace(const TopoDS_Shape& shape, bool firs
     return TopoDS::Face(shape);
 
   // Else, expect there to be ONE sub-face
-  auto faces = shape_components::AllFacesWithin(shape);
-  if (faces.empty())
-  {
-    return std::nullopt;
-  }
-  if (faces.size() > 1 && !firstOfMultipleOK)
-  {
-    return std::nullopt;
-  }
-  return faces[0];
+  return TryGetSingle<TopoDS_Face>(shape, firstOfMultipleOK);
 }
 
 std::optional<TopoDS_Edge> TryGetSingleEdge(const TopoDS_Shape& shape, bool firstOfMultipleOK)
@@ -359,16 +418,7 @@ std::optional<TopoDS_Edge> TryGetSingleEdge(const TopoDS_Shape& shape, bool firs
     return TopoDS::Edge(shape);
 
   // Else, expect there to be ONE sub-edge
-  auto edges = shape_components::AllEdgesWithin(shape);
-  if (edges.empty())
-  {
-    return std::nullopt;
-  }
-  if (edges.size() > 1 && !firstOfMultipleOK)
-  {
-    return std::nullopt;
-  }
-  return edges[0];
+  return TryGetSingle<TopoDS_Edge>(shape, firstOfMultipleOK);
 }
 
 std::optional<TopoDS_Wire> TryGetSingleWire(const TopoDS_Shape& shape, bool firstOfMultipleOK)
@@ -378,16 +428,7 @@ std::optional<TopoDS_Wire> TryGetSingleWire(const TopoDS_Shape& shape, bool firs
     return TopoDS::Wire(shape);
 
   // Else, expect there to be ONE sub-wire
-  auto wires = shape_components::AllWiresWithin(shape);
-  if (wires.empty())
-  {
-    return std::nullopt;
-  }
-  if (wires.size() > 1 && !firstOfMultipleOK)
-  {
-    return std::nullopt;
-  }
-  return wires[0];
+  return TryGetSingle<TopoDS_Wire>(shape, firstOfMultipleOK);
 }
 
 std::optional<TopoDS_Vertex> TryGetSingleVertex(const TopoDS_Shape& shape, bool firstOfMultipleOK)
@@ -397,16 +438,7 @@ std::optional<TopoDS_Vertex> TryGetSingleVertex(const TopoDS_Shape& shape, bool
     return TopoDS::Vertex(shape);
 
   // Else, expect there to be ONE sub-vertex
-  auto vertices = shape_components::AllVerticesWithin(shape);
-  if (vertices.empty())
-  {
-    return std::nullopt;
-  }
-  if (vertices.size() > 1 && !firstOfMultipleOK)
-  {
-    return std::nullopt;
-  }
-  return vertices[0];
+  return TryGetSingle<TopoDS_Vertex>(shape, firstOfMultipleOK);
 }
 
 //------------------------------------------------------------------------------
@@ -477,8 +509,17 @@ TopoDS_Vertex GetSingleVertex(const TopoDS_Shape& shape, bool firstOfMultipleOK)
   return opt.value();
 }
 
-size_t CountX(const TopoDS_Shape& shape, TopAbs_ShapeEnum type)
+size_t CountX(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, bool unique)
 {
+  if (unique)
+  {
+    TopTools_MapOfShape seen;
+    for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
+    {
+      seen.Add(xExplorer.Current());
+    }
+    return static_cast<size_t>(seen.Extent());
+  }
   size_t cnt = 0;
   for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
   {
@@ -487,8 +528,21 @@ size_t CountX(const TopoDS_Shape& shape, TopAbs_ShapeEnum type)
   return cnt;
 }
 
-size_t CountX(const std::vector<TopoDS_Shape>& shapes, TopAbs_ShapeEnum type)
+size_t CountX(const std::vector<TopoDS_Shape>& shapes, TopAbs_ShapeEnum type, bool unique)
 {
+  if (unique)
+  {
+    // Sub-shapes shared between the shapes count once, too
+    TopTools_MapOfShape seen;
+    for (const auto& shape : shapes)
+    {
+      for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
+      {
+        seen.Add(xExplorer.Current());
+      }
+    }
+    return static_cast<size_t>(seen.Extent());
+  }
   size_t cnt = 0;
   for (const auto& shape : shapes)
   {
@@ -497,4 +551,83 @@ size_t CountX(const std::vector<TopoDS_Shape>& shapes, TopAbs_ShapeEnum type)
   return cnt;
 }
 
+size_t CountX(const TopologyIndex& index, TopAbs_ShapeEnum type)
+{
+  return index.Count(type);
+}
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+
+/**
+ * Collect convert(subShape) for all sub-shapes of type [type] within the
+ * given shapes. Every shape fills its own slice of the preallocated result,
+ * located by a prefix sum over the per-shape counts, so the order matches
+ * the sequential overloads.
+ */
+template <typename T, typename Convert>
+std::vector<T> CollectParallel(const std::vector<TopoDS_Shape>& shapes,
+                               TopAbs_ShapeEnum                 type,
+                               const Convert&                   convert,
+                               size_t                           maxThreads)
+{
+  std::vector<size_t> offsets(shapes.size() + 1, 0);
+  parallel::For(
+    0, shapes.size(), [&](size_t i) { offsets[i + 1] = CountX(shapes[i], type); }, maxThreads);
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<T> result(offsets.back());
+  parallel::For(
+    0,
+    shapes.size(),
+    [&](size_t i)
+    {
+      size_t pos = offsets[i];
+      for (TopExp_Explorer xExplorer(shapes[i], type); xExplorer.More(); xExplorer.Next())
+      {
+        result[pos++] = convert(xExplorer.Current());
+      }
+    },
+    maxThreads);
+  return result;
+}
+
+} // namespace
+
+std::vector<TopoDS_Face> AllFacesWithinParallel(const std::vector<TopoDS_Shape>& shapes,
+                                                size_t                           maxThreads)
+{
+  return CollectParallel<TopoDS_Face>(
+    shapes, TopAbs_FACE, [](const TopoDS_Shape& face) { return TopoDS::Face(face); }, maxThreads);
+}
+
+std::vector<TopoDS_Edge> AllEdgesWithinParallel(const std::vector<TopoDS_Shape>& shapes,
+                                                size_t                           maxThreads)
+{
+  return CollectParallel<TopoDS_Edge>(
+    shapes, TopAbs_EDGE, [](const TopoDS_Shape& edge) { return TopoDS::Edge(edge); }, maxThreads);
+}
+
+std::vector<gp_Pnt> AllVertexCoordinatesWithinParallel(const std::vector<TopoDS_Shape>& shapes,
+                                                       size_t                           maxThreads)
+{
+  return CollectParallel<gp_Pnt>(
+    shapes,
+    TopAbs_VERTEX,
+    [](const TopoDS_Shape& vertex) { return BRep_Tool::Pnt(TopoDS::Vertex(vertex)); },
+    maxThreads);
+}
+
+size_t CountXParallel(const std::vector<TopoDS_Shape>& shapes,
+                      TopAbs_ShapeEnum                 type,
+                      size_t                           maxThreads)
+{
+  std::vector<size_t> counts(shapes.size(), 0);
+  parallel::For(
+    0, shapes.size(), [&](size_t i) { counts[i] = CountX(shapes[i], type); }, maxThreads);
+  return std::accumulate(counts.begin(), counts.end(), size_t(0));
+}
+
 } // namespace occutils::shape_components
@@ -0,0 +1,57 @@
+#include "occutils/occutils-shape-query.h"
+
+// OCC includes
+#include <TopExp_Explorer.hxx>
+
+namespace occutils::shape_components
+{
+
+bool Any(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, const ShapePredicate& predicate)
+{
+  return FindFirst(shape, type, predicate).has_value();
+}
+
+std::optional<TopoDS_Shape> FindFirst(const TopoDS_Shape&   shape,
+                                      TopAbs_ShapeEnum      type,
+                                      const ShapePredicate& predicate)
+{
+  for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
+  {
+    if (predicate(xExplorer.Current()))
+    {
+      return xExplorer.Current();
+    }
+  }
+  return std::nullopt;
+}
+
+bool CountAtMost(const TopoDS_Shape&   shape,
+                 TopAbs_ShapeEnum      type,
+                 size_t                maxCount,
+                 const ShapePredicate& predicate)
+{
+  size_t count = 0;
+  for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
+  {
+    if ((!predicate || predicate(xExplorer.Current())) && ++count > maxCount)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::pair<std::vector<TopoDS_Shape>, std::vector<TopoDS_Shape>> Partition(
+  const TopoDS_Shape&   shape,
+  TopAbs_ShapeEnum      type,
+  const ShapePredicate& predicate)
+{
+  auto ret = std::make_pair(std::vector<TopoDS_Shape>(), std::vector<TopoDS_Shape>());
+  for (TopExp_Explorer xExplorer(shape, type); xExplorer.More(); xExplorer.Next())
+  {
+    (predicate(xExplorer.Current()) ? ret.first : ret.second).push_back(xExplorer.Current());
+  }
+  return ret;
+}
+
+} // namespace occutils::shape_components
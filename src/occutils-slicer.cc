@@ -0,0 +1,249 @@
+#include "occutils/occutils-slicer.h"
+
+// std includes
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <utility>
+
+// OCC includes
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <Precision.hxx>
+#include <ShapeAnalysis_FreeBounds.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
+#include <gp_Ax3.hxx>
+#include <gp_Pln.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+#include "occutils/occutils-parallel.h"
+
+namespace occutils::slicer
+{
+
+namespace
+{
+
+/**
+ * The extent of a bounding box along an axis, measured from the axis
+ * location. Computed from the projection of the eight box corners, so it is
+ * exact for axis-aligned axes and conservative otherwise.
+ */
+std::pair<double, double> RangeAlong(const Bnd_Box& box, const gp_Ax1& axis)
+{
+  if (box.IsVoid())
+  {
+    return {std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+  }
+  const gp_XYZ minCorner = box.CornerMin().XYZ();
+  const gp_XYZ maxCorner = box.CornerMax().XYZ();
+  const gp_XYZ direction = axis.Direction().XYZ();
+  const gp_XYZ origin    = axis.Location().XYZ();
+
+  double low  = std::numeric_limits<double>::max();
+  double high = std::numeric_limits<double>::lowest();
+  for (int corner = 0; corner < 8; corner++)
+  {
+    const gp_XYZ point((corner & 1) ? maxCorner.X() : minCorner.X(),
+                       (corner & 2) ? maxCorner.Y() : minCorner.Y(),
+                       (corner & 4) ? maxCorner.Z() : minCorner.Z());
+    const double height = (point - origin).Dot(direction);
+    low                 = std::min(low, height);
+    high                = std::max(high, height);
+  }
+  return {low, high};
+}
+
+/**
+ * Section the given faces with the plane at the given height and connect the
+ * section edges into wires.
+ */
+void SliceLayer(const std::vector<TopoDS_Face>& faces,
+                const std::vector<int>&         bucket,
+                const gp_Ax1&                   axis,
+                const Bnd_Box&                  shapeBox,
+                const boolean::BooleanOptions&  options,
+                Layer&                          layer)
+{
+  if (bucket.empty())
+  {
+    return;
+  }
+  BRep_Builder    builder;
+  TopoDS_Compound layerFaces;
+  builder.MakeCompound(layerFaces);
+  for (const int face : bucket)
+  {
+    builder.Add(layerFaces, faces[face]);
+  }
+
+  // A finite plane face covering the whole shape, centered at the projection
+  // of the shape box center onto the plane
+  const gp_XYZ center    = (shapeBox.CornerMin().XYZ() + shapeBox.CornerMax().XYZ()) / 2.0;
+  const gp_XYZ direction = axis.Direction().XYZ();
+  const double offset    = layer.height - (center - axis.Location().XYZ()).Dot(direction);
+  const double extent    = std::sqrt(shapeBox.SquareExtent());
+  const gp_Pln plane(gp_Ax3(gp_Pnt(center + direction * offset), axis.Direction()));
+  const TopoDS_Face planeFace =
+    BRepBuilderAPI_MakeFace(plane, -extent, extent, -extent, extent).Face();
+
+  const TopoDS_Shape section = boolean::Section(layerFaces, planeFace, options);
+  if (section.IsNull())
+  {
+    layer.failed = true;
+    return;
+  }
+
+  occ::handle<TopTools_HSequenceOfShape> edges = new TopTools_HSequenceOfShape;
+  for (TopExp_Explorer exp(section, TopAbs_EDGE); exp.More(); exp.Next())
+  {
+    edges->Append(exp.Current());
+  }
+  if (edges->IsEmpty())
+  {
+    return;
+  }
+  occ::handle<TopTools_HSequenceOfShape> wires;
+  ShapeAnalysis_FreeBounds::ConnectEdgesToWires(edges,
+                                                10 * Precision::Confusion() + options.fuzzyValue,
+                                                Standard_False,
+                                                wires);
+  for (const TopoDS_Shape& wire : *wires)
+  {
+    if (BRep_Tool::IsClosed(wire))
+    {
+      layer.wires.push_back(TopoDS::Wire(wire));
+    }
+    else
+    {
+      layer.openWires++;
+    }
+  }
+}
+
+} // namespace
+
+std::vector<Layer> Slice(const TopoDS_Shape&            shape,
+                         const gp_Ax1&                  axis,
+                         const std::vector<double>&     heights,
+                         const boolean::BooleanOptions& options,
+                         size_t                         maxThreads)
+{
+  if (shape.IsNull())
+  {
+    throw OCCInvalidArgumentException("Slice shape must not be null!");
+  }
+
+  std::vector<Layer> layers(heights.size());
+  for (size_t i = 0; i < heights.size(); i++)
+  {
+    layers[i].height = heights[i];
+  }
+  std::sort(layers.begin(),
+            layers.end(),
+            [](const Layer& a, const Layer& b) { return a.height < b.height; });
+
+  // Collect the distinct faces and their extent along the axis
+  TopTools_IndexedMapOfShape faceMap;
+  for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next())
+  {
+    faceMap.Add(exp.Current());
+  }
+  std::vector<TopoDS_Face> faces(static_cast<size_t>(faceMap.Extent()));
+  std::vector<std::pair<double, double>> ranges(faces.size());
+  parallel::For(0,
+                faces.size(),
+                [&](size_t i)
+                {
+                  faces[i] = TopoDS::Face(faceMap(static_cast<int>(i) + 1));
+                  Bnd_Box box;
+                  BRepBndLib::Add(faces[i], box);
+                  ranges[i] = RangeAlong(box, axis);
+                },
+                maxThreads);
+
+  // Bucket every face into the layers its range spans
+  std::vector<std::vector<int>> buckets(layers.size());
+  const double                  tolerance = Precision::Confusion() + options.fuzzyValue;
+  for (size_t face = 0; face < faces.size(); face++)
+  {
+    const auto first = std::lower_bound(layers.begin(),
+                                        layers.end(),
+                                        ranges[face].first - tolerance,
+                                        [](const Layer& layer, double height)
+                                        { return layer.height < height; });
+    for (auto it = first; it != layers.end() && it->height <= ranges[face].second + tolerance;
+         ++it)
+    {
+      buckets[static_cast<size_t>(it - layers.begin())].push_back(static_cast<int>(face));
+    }
+  }
+
+  // A face spanning several layers is sectioned by several threads at once,
+  // so the sections must not update its tolerances in place
+  boolean::BooleanOptions sectionOptions = options;
+  sectionOptions.nonDestructive          = true;
+
+  Bnd_Box shapeBox;
+  BRepBndLib::Add(shape, shapeBox);
+  parallel::For(
+    0,
+    layers.size(),
+    [&](size_t i)
+    {
+      // Exceptions must not escape a worker
+      try
+      {
+        SliceLayer(faces, buckets[i], axis, shapeBox, sectionOptions, layers[i]);
+      }
+      catch (const Standard_Failure&)
+      {
+        layers[i].failed = true;
+      }
+      catch (const std::exception&)
+      {
+        layers[i].failed = true;
+      }
+    },
+    maxThreads);
+  return layers;
+}
+
+std::vector<Layer> SliceUniform(const TopoDS_Shape&            shape,
+                                const gp_Ax1&                  axis,
+                                double                         layerThickness,
+                                const boolean::BooleanOptions& options,
+                                size_t                         maxThreads)
+{
+  if (shape.IsNull())
+  {
+    throw OCCInvalidArgumentException("SliceUniform shape must not be null!");
+  }
+  if (!(layerThickness > 0.0))
+  {
+    throw OCCInvalidArgumentException("SliceUniform layerThickness must be positive!");
+  }
+  Bnd_Box shapeBox;
+  BRepBndLib::Add(shape, shapeBox);
+  const auto [low, high] = RangeAlong(shapeBox, axis);
+
+  std::vector<double> heights;
+  for (size_t i = 0; low + (static_cast<double>(i) + 0.5) * layerThickness < high; i++)
+  {
+    heights.push_back(low + (static_cast<double>(i) + 0.5) * layerThickness);
+  }
+  return Slice(shape, axis, heights, options, maxThreads);
+}
+
+} // namespace occutils::slicer
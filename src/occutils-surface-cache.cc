@@ -0,0 +1,30 @@
+#include "occutils/occutils-surface-cache.h"
+
+namespace occutils::surface
+{
+
+AdaptorCache::AdaptorCache(SurfaceLookup lookup)
+    : m_lookup(lookup)
+{
+}
+
+const GeomAdaptor_Surface& AdaptorCache::Get(const TopoDS_Face& face)
+{
+  if (const GeomAdaptor_Surface* adaptor = m_adaptors.Seek(face))
+  {
+    return *adaptor;
+  }
+  return *m_adaptors.Bound(face, FromFace(face, m_lookup));
+}
+
+size_t AdaptorCache::Size() const
+{
+  return static_cast<size_t>(m_adaptors.Extent());
+}
+
+void AdaptorCache::Clear()
+{
+  m_adaptors.Clear();
+}
+
+} // namespace occutils::surface
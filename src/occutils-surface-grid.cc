@@ -0,0 +1,224 @@
+#include "occutils/occutils-surface-grid.h"
+
+// std includes
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+// OCC includes
+#include <BRepTools.hxx>
+#include <GeomLProp_SLProps.hxx>
+#include <Standard_Failure.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Vec.hxx>
+
+// occutils includes
+#include "occutils/occutils-parallel.h"
+#include "occutils/occutils-surface.h"
+
+namespace occutils::surface
+{
+
+namespace
+{
+
+/**
+ * @return [count] uniformly spaced values from first to last, both included.
+ */
+std::vector<double> Linspace(double first, double last, size_t count)
+{
+  std::vector<double> ret(count, first);
+  for (size_t i = 1; i < count; i++)
+  {
+    ret[i] = first + (last - first) * static_cast<double>(i) / static_cast<double>(count - 1);
+  }
+  return ret;
+}
+
+/**
+ * Resize all arrays of the samples, dropping the derivatives if not
+ * requested.
+ */
+void Resize(GridSamples& samples, size_t count, bool withDerivatives)
+{
+  for (std::vector<double>* array :
+       {&samples.x, &samples.y, &samples.z, &samples.nx, &samples.ny, &samples.nz})
+  {
+    array->resize(count);
+  }
+  const size_t derivativeCount = withDerivatives ? count : 0;
+  for (std::vector<double>* array :
+       {&samples.dux, &samples.duy, &samples.duz, &samples.dvx, &samples.dvy, &samples.dvz})
+  {
+    array->resize(derivativeCount);
+  }
+}
+
+/**
+ * Evaluate the surface on the grid and write the samples from index
+ * [offset] on. Derivatives are written if the derivative arrays are not
+ * empty.
+ */
+void EvaluateInto(const GeomAdaptor_Surface& surf,
+                  const UVGrid&              grid,
+                  double                     precision,
+                  GridSamples&               samples,
+                  size_t                     offset)
+{
+  const bool withDerivatives = !samples.dux.empty();
+
+  // Only created for singular points
+  std::optional<GeomLProp_SLProps> props;
+
+  size_t index = offset;
+  for (double u : grid.u)
+  {
+    for (double v : grid.v)
+    {
+      gp_Pnt point;
+      gp_Vec du;
+      gp_Vec dv;
+      surf.D1(u, v, point, du, dv);
+      samples.x[index] = point.X();
+      samples.y[index] = point.Y();
+      samples.z[index] = point.Z();
+
+      gp_Vec normal = du.Crossed(dv);
+      if (normal.Magnitude() > precision)
+      {
+        normal.Normalize();
+      }
+      else
+      {
+        if (!props)
+        {
+          props.emplace(surf.Surface(), 1 /* max 1 derivation */, precision);
+        }
+        props->SetParameters(u, v);
+        normal = props->IsNormalDefined() ? gp_Vec(props->Normal()) : gp_Vec();
+      }
+      samples.nx[index] = normal.X();
+      samples.ny[index] = normal.Y();
+      samples.nz[index] = normal.Z();
+
+      if (withDerivatives)
+      {
+        samples.dux[index] = du.X();
+        samples.duy[index] = du.Y();
+        samples.duz[index] = du.Z();
+        samples.dvx[index] = dv.X();
+        samples.dvy[index] = dv.Y();
+        samples.dvz[index] = dv.Z();
+      }
+      index++;
+    }
+  }
+}
+
+/**
+ * Set the samples [first, first + count) to NaN.
+ */
+void FillNaN(GridSamples& samples, size_t first, size_t count)
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (std::vector<double>* array : {&samples.x,
+                                     &samples.y,
+                                     &samples.z,
+                                     &samples.nx,
+                                     &samples.ny,
+                                     &samples.nz,
+                                     &samples.dux,
+                                     &samples.duy,
+                                     &samples.duz,
+                                     &samples.dvx,
+                                     &samples.dvy,
+                                     &samples.dvz})
+  {
+    if (!array->empty())
+    {
+      std::fill(array->begin() + first, array->begin() + first + count, nan);
+    }
+  }
+}
+
+} // namespace
+
+UVGrid UniformUVGrid(const GeomAdaptor_Surface& surf, size_t uSamples, size_t vSamples)
+{
+  return {Linspace(surf.FirstUParameter(), surf.LastUParameter(), uSamples),
+          Linspace(surf.FirstVParameter(), surf.LastVParameter(), vSamples)};
+}
+
+UVGrid UniformUVGrid(const TopoDS_Face& face, size_t uSamples, size_t vSamples)
+{
+  double uMin;
+  double uMax;
+  double vMin;
+  double vMax;
+  BRepTools::UVBounds(face, uMin, uMax, vMin, vMax);
+  return {Linspace(uMin, uMax, uSamples), Linspace(vMin, vMax, vSamples)};
+}
+
+//------------------------------------------------------------------------------
+
+GridSamples EvaluateGrid(const GeomAdaptor_Surface& surf,
+                         const UVGrid&              grid,
+                         bool                       withDerivatives,
+                         double                     precision)
+{
+  GridSamples ret;
+  Resize(ret, grid.Size(), withDerivatives);
+  EvaluateInto(surf, grid, precision, ret, 0);
+  return ret;
+}
+
+GridSamples EvaluateGrid(const TopoDS_Face& face,
+                         const UVGrid&      grid,
+                         bool               withDerivatives,
+                         double             precision)
+{
+  const GeomAdaptor_Surface surf = FromFace(face);
+  if (surf.Surface().IsNull())
+  {
+    return {};
+  }
+  return EvaluateGrid(surf, grid, withDerivatives, precision);
+}
+
+GridSamples EvaluateGrids(const std::vector<TopoDS_Face>& faces,
+                          size_t                          uSamples,
+                          size_t                          vSamples,
+                          bool                            withDerivatives,
+                          size_t                          maxThreads)
+{
+  const size_t samplesPerFace = uSamples * vSamples;
+
+  GridSamples ret;
+  Resize(ret, faces.size() * samplesPerFace, withDerivatives);
+  parallel::For(
+    0,
+    faces.size(),
+    [&](size_t i)
+    {
+      const size_t offset = i * samplesPerFace;
+      try
+      {
+        // Every face has its own adaptor, which is not shared across threads
+        const GeomAdaptor_Surface surf = FromFace(faces[i]);
+        if (!surf.Surface().IsNull())
+        {
+          EvaluateInto(surf, UniformUVGrid(faces[i], uSamples, vSamples), 1e-6, ret, offset);
+          return;
+        }
+      }
+      catch (const Standard_Failure&)
+      {
+        // Treat like a face without surface
+      }
+      FillNaN(ret, offset, samplesPerFace);
+    },
+    maxThreads);
+  return ret;
+}
+
+} // namespace occutils::surface
@@ -10,11 +10,13 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepGProp.hxx>
 #include <BRepLib_FindSurface.hxx>
+#include <BRep_Tool.hxx>
 #include <GC_MakeLine.hxx>
 #include <GProp_GProps.hxx>
 #include <GeomAPI_IntCS.hxx>
 #include <GeomAPI_IntSS.hxx>
 #include <GeomLProp_SLProps.hxx>
+#include <Geom_Surface.hxx>
 #include <TopoDS_Edge.hxx>
 #include <gp_Ax1.hxx>
 #include <gp_Lin.hxx>
@@ -45,14 +47,28 @@ gp_Pnt CenterOfMass(const TopoDS_Shape& face)
   return gprops.CentreOfMass();
 }
 
-GeomAdaptor_Surface FromFace(const TopoDS_Face& face)
+GeomAdaptor_Surface FromFace(const TopoDS_Face& face, const SurfaceLookup lookup)
 {
+  if (lookup == SurfaceLookup::Stored)
+  {
+    // A copy transformed by the location of the face, if any
+    const occ::handle<Geom_Surface> stored = BRep_Tool::Surface(face);
+    if (!stored.IsNull())
+    {
+      return stored;
+    }
+  }
   const BRepLib_FindSurface bfs(face);
   if (!bfs.Found())
   {
     return {};
   }
-  return bfs.Surface();
+  if (bfs.Location().IsIdentity())
+  {
+    return bfs.Surface();
+  }
+  return occ::handle<Geom_Surface>::DownCast(
+    bfs.Surface()->Transformed(bfs.Location().Transformation()));
 }
 
 std::pair<double, gp_Pnt> AreaAndCenterOfMass(const TopoDS_Shape& face)
@@ -0,0 +1,133 @@
+#include "occutils/occutils-topology-index.h"
+
+// OCC includes
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+
+namespace occutils::shape_components
+{
+
+TopologyIndex::TopologyIndex(const TopoDS_Shape& shape) : m_shape(shape)
+{
+  if (!shape.IsNull())
+  {
+    Visit(shape);
+  }
+}
+
+void TopologyIndex::Visit(const TopoDS_Shape& shape)
+{
+  TopTools_IndexedMapOfShape& map    = m_maps[shape.ShapeType()];
+  const int                   extent = map.Extent();
+  if (map.Add(shape) <= extent)
+  {
+    // Seen before, and so was its whole subtree
+    return;
+  }
+  switch (shape.ShapeType())
+  {
+    case TopAbs_SOLID:
+      m_solids.push_back(TopoDS::Solid(shape));
+      break;
+    case TopAbs_SHELL:
+      m_shells.push_back(TopoDS::Shell(shape));
+      break;
+    case TopAbs_FACE:
+      m_faces.push_back(TopoDS::Face(shape));
+      break;
+    case TopAbs_WIRE:
+      m_wires.push_back(TopoDS::Wire(shape));
+      break;
+    case TopAbs_EDGE:
+      m_edges.push_back(TopoDS::Edge(shape));
+      break;
+    case TopAbs_VERTEX:
+      m_vertices.push_back(TopoDS::Vertex(shape));
+      break;
+    default:
+      break;
+  }
+  // The iterator composes orientation and location like TopExp_Explorer
+  for (TopoDS_Iterator it(shape); it.More(); it.Next())
+  {
+    Visit(it.Value());
+  }
+}
+
+const TopoDS_Shape& TopologyIndex::Shape() const
+{
+  return m_shape;
+}
+
+size_t TopologyIndex::Count(TopAbs_ShapeEnum type) const
+{
+  return static_cast<size_t>(Map(type).Extent());
+}
+
+const TopoDS_Shape& TopologyIndex::Get(TopAbs_ShapeEnum type, size_t id) const
+{
+  const TopTools_IndexedMapOfShape& map = Map(type);
+  if (id >= static_cast<size_t>(map.Extent()))
+  {
+    throw OCCInvalidArgumentException("TopologyIndex ID out of range");
+  }
+  return map(static_cast<int>(id) + 1);
+}
+
+std::optional<size_t> TopologyIndex::IdOf(const TopoDS_Shape& subShape) const
+{
+  if (subShape.IsNull())
+  {
+    return std::nullopt;
+  }
+  const int index = Map(subShape.ShapeType()).FindIndex(subShape);
+  if (index == 0)
+  {
+    return std::nullopt;
+  }
+  return static_cast<size_t>(index - 1);
+}
+
+const TopTools_IndexedMapOfShape& TopologyIndex::Map(TopAbs_ShapeEnum type) const
+{
+  if (type == TopAbs_SHAPE)
+  {
+    throw OCCInvalidArgumentException("TopologyIndex has no map for TopAbs_SHAPE");
+  }
+  return m_maps[type];
+}
+
+const std::vector<TopoDS_Solid>& TopologyIndex::Solids() const
+{
+  return m_solids;
+}
+
+const std::vector<TopoDS_Shell>& TopologyIndex::Shells() const
+{
+  return m_shells;
+}
+
+const std::vector<TopoDS_Face>& TopologyIndex::Faces() const
+{
+  return m_faces;
+}
+
+const std::vector<TopoDS_Wire>& TopologyIndex::Wires() const
+{
+  return m_wires;
+}
+
+const std::vector<TopoDS_Edge>& TopologyIndex::Edges() const
+{
+  return m_edges;
+}
+
+const std::vector<TopoDS_Vertex>& TopologyIndex::Vertices() const
+{
+  return m_vertices;
+}
+
+} // namespace occutils::shape_components
@@ -0,0 +1,205 @@
+#include "occutils/occutils-vertex-export.h"
+
+// std includes
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+// OCC includes
+#include <BRep_Tool.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-exceptions.h"
+
+namespace occutils::shape_components
+{
+
+namespace
+{
+
+/**
+ * Cell of the uniform grid used to find coincident points.
+ */
+struct GridCell
+{
+  int64_t i, j, k;
+
+  bool operator==(const GridCell& other) const
+  {
+    return i == other.i && j == other.j && k == other.k;
+  }
+};
+
+struct GridCellHasher
+{
+  size_t operator()(const GridCell& cell) const
+  {
+    // Large primes, as in common spatial hashing schemes
+    return static_cast<size_t>((static_cast<uint64_t>(cell.i) * 73856093u) ^
+                               (static_cast<uint64_t>(cell.j) * 19349663u) ^
+                               (static_cast<uint64_t>(cell.k) * 83492791u));
+  }
+};
+
+/**
+ * Visit the points of all vertices of the index, merged within [tolerance].
+ * Calls store(pointIndex, point) once per new point and fills pointOfVertex
+ * if it is not null.
+ *
+ * @return The number of points.
+ */
+template <typename Store>
+size_t VisitPoints(const TopologyIndex& index,
+                   int*                 pointOfVertex,
+                   double               tolerance,
+                   const Store&         store)
+{
+  const std::vector<TopoDS_Vertex>& vertices = index.Vertices();
+  if (tolerance <= 0.0)
+  {
+    for (size_t vertex = 0; vertex < vertices.size(); vertex++)
+    {
+      store(vertex, BRep_Tool::Pnt(vertices[vertex]));
+      if (pointOfVertex != nullptr)
+      {
+        pointOfVertex[vertex] = static_cast<int>(vertex);
+      }
+    }
+    return vertices.size();
+  }
+
+  // Cells as large as the tolerance, so a close point is in one of the
+  // 27 cells around the query point
+  const auto cellOf = [tolerance](const gp_Pnt& point)
+  {
+    return GridCell{static_cast<int64_t>(std::floor(point.X() / tolerance)),
+                    static_cast<int64_t>(std::floor(point.Y() / tolerance)),
+                    static_cast<int64_t>(std::floor(point.Z() / tolerance))};
+  };
+  std::unordered_map<GridCell, std::vector<size_t>, GridCellHasher> grid;
+  std::vector<gp_Pnt>                                                points;
+  points.reserve(vertices.size());
+  grid.reserve(vertices.size());
+
+  for (size_t vertex = 0; vertex < vertices.size(); vertex++)
+  {
+    const gp_Pnt   point = BRep_Tool::Pnt(vertices[vertex]);
+    const GridCell cell  = cellOf(point);
+    size_t         found = points.size();
+    for (int64_t di = -1; di <= 1 && found == points.size(); di++)
+    {
+      for (int64_t dj = -1; dj <= 1 && found == points.size(); dj++)
+      {
+        for (int64_t dk = -1; dk <= 1 && found == points.size(); dk++)
+        {
+          const auto it = grid.find(GridCell{cell.i + di, cell.j + dj, cell.k + dk});
+          if (it == grid.end())
+          {
+            continue;
+          }
+          for (const size_t candidate : it->second)
+          {
+            if (points[candidate].SquareDistance(point) <= tolerance * tolerance)
+            {
+              found = candidate;
+              break;
+            }
+          }
+        }
+      }
+    }
+    if (found == points.size())
+    {
+      store(found, point);
+      points.push_back(point);
+      grid[cell].push_back(found);
+    }
+    if (pointOfVertex != nullptr)
+    {
+      pointOfVertex[vertex] = static_cast<int>(found);
+    }
+  }
+  return points.size();
+}
+
+} // namespace
+
+VertexCoordinateArrays ExportVertexCoordinates(const TopologyIndex& index,
+                                               CoordinateLayout     layout,
+                                               bool                 withVertexMap,
+                                               double               mergeTolerance)
+{
+  const size_t vertexCount = index.Count(TopAbs_VERTEX);
+
+  VertexCoordinateArrays ret;
+  if (withVertexMap)
+  {
+    ret.pointOfVertex.resize(vertexCount);
+  }
+  int* pointOfVertex = withVertexMap ? ret.pointOfVertex.data() : nullptr;
+
+  if (layout == CoordinateLayout::Interleaved)
+  {
+    ret.xyz.resize(3 * vertexCount);
+    const size_t count =
+      ExportVertexCoordinatesInterleaved(index, ret.xyz.data(), pointOfVertex, mergeTolerance);
+    ret.xyz.resize(3 * count);
+  }
+  else
+  {
+    ret.x.resize(vertexCount);
+    ret.y.resize(vertexCount);
+    ret.z.resize(vertexCount);
+    const size_t count = ExportVertexCoordinates(
+      index, ret.x.data(), ret.y.data(), ret.z.data(), pointOfVertex, mergeTolerance);
+    ret.x.resize(count);
+    ret.y.resize(count);
+    ret.z.resize(count);
+  }
+  return ret;
+}
+
+size_t ExportVertexCoordinates(const TopologyIndex& index,
+                               double*              x,
+                               double*              y,
+                               double*              z,
+                               int*                 pointOfVertex,
+                               double               mergeTolerance)
+{
+  if (index.Count(TopAbs_VERTEX) > 0 && (x == nullptr || y == nullptr || z == nullptr))
+  {
+    throw OCCInvalidArgumentException("Coordinate buffers must not be null!");
+  }
+  return VisitPoints(index,
+                     pointOfVertex,
+                     mergeTolerance,
+                     [x, y, z](size_t i, const gp_Pnt& point)
+                     {
+                       x[i] = point.X();
+                       y[i] = point.Y();
+                       z[i] = point.Z();
+                     });
+}
+
+size_t ExportVertexCoordinatesInterleaved(const TopologyIndex& index,
+                                          double*              xyz,
+                                          int*                 pointOfVertex,
+                                          double               mergeTolerance)
+{
+  if (index.Count(TopAbs_VERTEX) > 0 && xyz == nullptr)
+  {
+    throw OCCInvalidArgumentException("Coordinate buffer must not be null!");
+  }
+  return VisitPoints(index,
+                     pointOfVertex,
+                     mergeTolerance,
+                     [xyz](size_t i, const gp_Pnt& point)
+                     {
+                       xyz[3 * i]     = point.X();
+                       xyz[3 * i + 1] = point.Y();
+                       xyz[3 * i + 2] = point.Z();
+                     });
+}
+
+} // namespace occutils::shape_components
@@ -0,0 +1,82 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+
+// std includes
+#include <algorithm>
+
+// gtest includes
+#include <gtest/gtest.h>
+
+// OCC includes
+#include <TopoDS_Solid.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-adjacency-graph.h"
+#include "occutils/occutils-boolean.h"
+#include "occutils/occutils-primitive.h"
+
+using namespace occutils;
+
+TEST(test_adjacency_graph, AdjacencyGraphTest_Box)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+
+  const shape_components::AdjacencyGraph graph(box);
+
+  ASSERT_EQ(graph.NbFaces(), 6);
+  ASSERT_EQ(graph.NbEdges(), 12);
+  EXPECT_EQ(graph.NbVertices(), 8);
+  for (int face = 0; face < graph.NbFaces(); face++)
+  {
+    EXPECT_EQ(graph.FaceEdges(face).size(), 4u);
+    EXPECT_EQ(graph.FaceNeighbors(face).size(), 4u);
+  }
+  for (int edge = 0; edge < graph.NbEdges(); edge++)
+  {
+    EXPECT_EQ(graph.EdgeFaces(edge).size(), 2u);
+    EXPECT_EQ(graph.EdgeVertices(edge).size(), 2u);
+    EXPECT_EQ(graph.EdgeConvexity(edge), shape_components::Convexity::Convex);
+  }
+  EXPECT_EQ(graph.ReachableFaces(0).size(), 6u);
+  EXPECT_EQ(graph.ReachableFaces(0, [](int /* edge */) { return false; }).size(), 1u);
+
+  const auto components = graph.FaceComponents();
+  EXPECT_TRUE(std::all_of(components.begin(), components.end(), [](int c) { return c == 0; }));
+}
+
+TEST(test_adjacency_graph, AdjacencyGraphTest_Pocket)
+{
+  const TopoDS_Shape part = boolean::Cut(primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 5)),
+                                         primitive::MakeBox(gp_Pnt(2, 2, 3), gp_Pnt(8, 8, 6)));
+  ASSERT_FALSE(part.IsNull());
+
+  const shape_components::AdjacencyGraph graph(part);
+
+  // The four floor edges and the four vertical pocket edges are concave
+  int concaveEdges = 0;
+  for (int edge = 0; edge < graph.NbEdges(); edge++)
+  {
+    concaveEdges += graph.EdgeConvexity(edge) == shape_components::Convexity::Concave ? 1 : 0;
+  }
+  EXPECT_EQ(concaveEdges, 8);
+
+  // Crossing only concave edges groups the pocket floor and walls
+  const auto isConcave = [&graph](int edge)
+  { return graph.EdgeConvexity(edge) == shape_components::Convexity::Concave; };
+  const auto components     = graph.FaceComponents(isConcave);
+  const int  componentCount = *std::max_element(components.begin(), components.end()) + 1;
+  // 5 pocket faces in one component, plus 6 outer faces (the top face has a hole)
+  EXPECT_EQ(componentCount, 7);
+}
@@ -17,7 +17,12 @@
 
 // The following lines pull in the real occutils-test-*.cc files.
 
+#include "occutils-test-adjacency-graph.cc"
+#include "occutils-test-boolean.cc"
 #include "occutils-test-bounding-box.cc"
 #include "occutils-test-ldom.cc"
 #include "occutils-test-line.cc"
+#include "occutils-test-shape-components.cc"
+#include "occutils-test-slicer.cc"
+#include "occutils-test-surface.cc"
 #include "xde/occutils-test-xde-doc.cc"
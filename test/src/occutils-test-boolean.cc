@@ -0,0 +1,429 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+// std includes
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// gtest includes
+#include <gtest/gtest.h>
+
+// OCC includes
+#include <BRep_Tool.hxx>
+#include <Precision.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Solid.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-boolean-batch.h"
+#include "occutils/occutils-boolean-cache.h"
+#include "occutils/occutils-boolean-incremental-cutter.h"
+#include "occutils/occutils-boolean-session.h"
+#include "occutils/occutils-boolean.h"
+#include "occutils/occutils-list-utils.h"
+#include "occutils/occutils-primitive.h"
+#include "occutils/occutils-shape.h"
+
+using namespace occutils;
+
+TEST(test_boolean, DefaultOptionsTest_RoundTrip)
+{
+  const boolean::BooleanOptions previous = boolean::DefaultOptions();
+
+  boolean::BooleanOptions options;
+  options.runParallel = true;
+  options.fuzzyValue  = 1e-5;
+  options.glue        = BOPAlgo_GlueShift;
+  boolean::SetDefaultOptions(options);
+
+  const boolean::BooleanOptions current = boolean::DefaultOptions();
+  EXPECT_TRUE(current.runParallel);
+  EXPECT_DOUBLE_EQ(current.fuzzyValue, 1e-5);
+  EXPECT_EQ(current.glue, BOPAlgo_GlueShift);
+
+  // Restore the defaults for the remaining tests
+  boolean::SetDefaultOptions(previous);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, FuseTest_WithOptions)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3));
+
+  boolean::BooleanOptions options;
+  options.runParallel = true;
+  options.useOBB      = true;
+
+  const TopoDS_Shape result = boolean::Fuse({box1, box2}, options);
+
+  ASSERT_FALSE(result.IsNull()) << "Fuse result is not null";
+  EXPECT_NEAR(shape::Volume(result), 15.0, 1e-6) << "Union volume is 8 + 8 - 1";
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, CommonTest_TwoShapes)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3));
+
+  const TopoDS_Shape result = boolean::Common(TopoDS_Shape(box1), TopoDS_Shape(box2));
+
+  ASSERT_FALSE(result.IsNull()) << "Common result is not null";
+  EXPECT_NEAR(shape::Volume(result), 1.0, 1e-6) << "Intersection volume is 1";
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, CullToolsTest_DropsDistantTools)
+{
+  const TopoDS_Solid plate = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 1));
+  const TopoDS_Solid near  = primitive::MakeBox(gp_Pnt(1, 1, -1), gp_Pnt(2, 2, 2));
+  const TopoDS_Solid far   = primitive::MakeBox(gp_Pnt(20, 20, 0), gp_Pnt(21, 21, 1));
+
+  const boolean::CullResult result = boolean::CullTools(
+    list_utils::ToOCCList<TopoDS_Shape>({plate}),
+    list_utils::ToOCCList<TopoDS_Shape>({near, far}),
+    boolean::BroadPhase::Box);
+
+  EXPECT_EQ(result.culledCount, 1u) << "The distant tool is culled";
+  ASSERT_EQ(result.tools.Size(), 1) << "The overlapping tool is kept";
+  EXPECT_TRUE(result.tools.First().IsSame(near));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, CommonTest_BroadPhaseShortCircuit)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(5, 5, 5), gp_Pnt(6, 6, 6));
+
+  boolean::BooleanOptions options;
+  options.broadPhase = boolean::BroadPhase::OrientedBox;
+
+  size_t             culled = 0;
+  const TopoDS_Shape result = boolean::Common(list_utils::ToOCCList<TopoDS_Shape>({box1}),
+                                              list_utils::ToOCCList<TopoDS_Shape>({box2}),
+                                              options,
+                                              &culled);
+
+  ASSERT_FALSE(result.IsNull()) << "Common result is an empty compound";
+  EXPECT_EQ(culled, 1u);
+  EXPECT_NEAR(shape::Volume(result), 0.0, 1e-9);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, RunBatchTest_ResultsInInputOrder)
+{
+  std::vector<boolean::Job> jobs;
+  for (int i = 1; i <= 4; i++)
+  {
+    boolean::Job job;
+    job.operation = boolean::Operation::Cut;
+    job.arguments.Append(primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(i, 1, 1)));
+    job.tools.Append(primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1)));
+    jobs.push_back(job);
+  }
+  // An invalid job must not affect the others
+  jobs.push_back(boolean::Job());
+
+  const std::vector<boolean::JobResult> results = boolean::RunBatch(jobs, 2);
+
+  ASSERT_EQ(results.size(), jobs.size());
+  for (size_t i = 0; i < 4; i++)
+  {
+    ASSERT_EQ(results[i].status, boolean::Status::Done);
+    EXPECT_NEAR(shape::Volume(results[i].shape), static_cast<double>(i), 1e-6);
+  }
+  EXPECT_EQ(results[4].status, boolean::Status::InvalidArgument);
+  EXPECT_FALSE(results[4].error.empty());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, RunBatchTest_SharedTool)
+{
+  // Both jobs cut with the very same tool shape at the same time
+  const TopoDS_Solid tool = primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3));
+
+  std::vector<boolean::Job> jobs(2);
+  for (boolean::Job& job : jobs)
+  {
+    job.operation = boolean::Operation::Cut;
+    job.tools.Append(tool);
+  }
+  jobs[0].arguments.Append(primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2)));
+  jobs[1].arguments.Append(primitive::MakeBox(gp_Pnt(2, 2, 2), gp_Pnt(4, 4, 4)));
+
+  const std::vector<boolean::JobResult> results = boolean::RunBatch(jobs);
+
+  ASSERT_EQ(results.size(), 2u);
+  for (const boolean::JobResult& result : results)
+  {
+    ASSERT_EQ(result.status, boolean::Status::Done);
+    EXPECT_NEAR(shape::Volume(result.shape), 7.0, 1e-6);
+  }
+  for (TopExp_Explorer exp(tool, TopAbs_VERTEX); exp.More(); exp.Next())
+  {
+    EXPECT_DOUBLE_EQ(BRep_Tool::Tolerance(TopoDS::Vertex(exp.Current())), Precision::Confusion())
+      << "The shared tool must not be modified";
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, IncrementalCutterTest_SkipsDistantTools)
+{
+  boolean::IncrementalCutter cutter(primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 2)));
+
+  // Drill a hole through the plate, then "cut" far away from it
+  EXPECT_TRUE(cutter.Cut(primitive::MakeBox(gp_Pnt(1, 1, -1), gp_Pnt(2, 2, 3))));
+  EXPECT_TRUE(cutter.Cut(primitive::MakeBox(gp_Pnt(20, 20, 0), gp_Pnt(21, 21, 1))));
+
+  ASSERT_EQ(cutter.Steps().size(), 2u);
+  EXPECT_FALSE(cutter.Steps()[0].skipped);
+  EXPECT_GT(cutter.Steps()[0].candidateFaces, 0u);
+  EXPECT_TRUE(cutter.Steps()[1].skipped);
+  EXPECT_EQ(cutter.FaceCount(), 10u) << "6 plate faces + 4 hole faces";
+  EXPECT_NEAR(shape::Volume(cutter.Stock()), 198.0, 1e-6);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, ResultCacheTest_HitOnEqualGeometry)
+{
+  boolean::ResultCache cache;
+
+  // Separately built, but geometrically identical inputs share one entry
+  for (int i = 0; i < 2; i++)
+  {
+    const TopoDS_Shape result = cache.Perform(
+      boolean::Operation::Common,
+      list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2))}),
+      list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3))}));
+    ASSERT_FALSE(result.IsNull());
+    EXPECT_NEAR(shape::Volume(result), 1.0, 1e-6);
+  }
+
+  EXPECT_EQ(cache.Misses(), 1u);
+  EXPECT_EQ(cache.Hits(), 1u);
+  EXPECT_EQ(cache.Size(), 1u);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, UnifySameDomainTest_MergesCoplanarFaces)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(1, 0, 0), gp_Pnt(2, 1, 1));
+
+  const TopoDS_Shape fused = boolean::Fuse({box1, box2});
+  ASSERT_FALSE(fused.IsNull());
+
+  const boolean::UnifyResult result = boolean::UnifySameDomain(fused);
+
+  ASSERT_FALSE(result.shape.IsNull());
+  EXPECT_EQ(result.facesBefore, 10u) << "Four side faces are split in two";
+  EXPECT_EQ(result.facesAfter, 6u) << "Unified result is a plain box";
+  EXPECT_LT(result.edgesAfter, result.edgesBefore);
+  EXPECT_NEAR(shape::Volume(result.shape), 2.0, 1e-6);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, PerformTest_ProgressCancellation)
+{
+  const auto arguments =
+    list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2))});
+  const auto tools =
+    list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3))});
+
+  // Without limits, progress is reported and the operation completes
+  bool                     reported = false;
+  boolean::ProgressControl control;
+  control.onProgress = [&](double fraction)
+  {
+    reported = true;
+    EXPECT_GE(fraction, 0.0);
+    EXPECT_LE(fraction, 1.0);
+    return true;
+  };
+  const boolean::ControlledResult done =
+    boolean::Perform(boolean::Operation::Cut, arguments, tools, control);
+  EXPECT_EQ(done.status, boolean::Status::Done);
+  EXPECT_TRUE(reported);
+  EXPECT_NEAR(shape::Volume(done.shape), 7.0, 1e-6);
+
+  // A callback refusing to continue cancels the operation
+  control.onProgress = [](double) { return false; };
+  const boolean::ControlledResult cancelled =
+    boolean::Perform(boolean::Operation::Cut, arguments, tools, control);
+  EXPECT_EQ(cancelled.status, boolean::Status::Cancelled);
+  EXPECT_TRUE(cancelled.shape.IsNull());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, PerformTest_TimeBudget)
+{
+  const auto arguments =
+    list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2))});
+  const auto tools =
+    list_utils::ToOCCList<TopoDS_Shape>({primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3))});
+
+  // A slow progress callback makes the operation run past its budget
+  boolean::ProgressControl control;
+  control.timeBudgetSeconds = 0.001;
+  control.onProgress        = [](double)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return true;
+  };
+  const boolean::ControlledResult timedOut =
+    boolean::Perform(boolean::Operation::Cut, arguments, tools, control);
+  EXPECT_EQ(timedOut.status, boolean::Status::TimedOut);
+  EXPECT_TRUE(timedOut.shape.IsNull());
+  EXPECT_FALSE(timedOut.error.empty());
+
+  // The budget of a batch job is reported the same way
+  boolean::Job job;
+  job.operation         = boolean::Operation::Cut;
+  job.arguments         = arguments;
+  job.tools             = tools;
+  job.timeBudgetSeconds = 1e-9;
+
+  const std::vector<boolean::JobResult> results = boolean::RunBatch({job});
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].status, boolean::Status::TimedOut);
+  EXPECT_TRUE(results[0].shape.IsNull());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, SessionTest_MatchesStandaloneOperations)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 4));
+
+  const boolean::Session session(box1, box2);
+  ASSERT_TRUE(session.IsDone());
+
+  const std::pair<TopoDS_Shape, TopoDS_Shape> expected[] = {
+    {session.Fuse(), boolean::Fuse({box1, box2})},
+    {session.Cut(), boolean::Cut(box1, box2)},
+    {session.CutReversed(), boolean::Cut(box2, box1)},
+    {session.Common(), boolean::Common(box1, box2)},
+  };
+  for (const auto& [result, standalone] : expected)
+  {
+    ASSERT_FALSE(result.IsNull());
+    ASSERT_FALSE(standalone.IsNull());
+    EXPECT_NEAR(shape::Volume(result), shape::Volume(standalone), 1e-6);
+  }
+  EXPECT_NEAR(shape::Volume(session.Cut()), 7.0, 1e-6);
+  EXPECT_NEAR(shape::Volume(session.CutReversed()), 11.0, 1e-6);
+  EXPECT_NEAR(shape::Volume(session.Common()), 1.0, 1e-6);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, SessionTest_ReusesIntersection)
+{
+  const TopoDS_Solid box1 = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 2, 2));
+  const TopoDS_Solid box2 = primitive::MakeBox(gp_Pnt(1, 1, 1), gp_Pnt(3, 3, 3));
+
+  const boolean::Session session(box1, box2);
+  const TopoDS_Shape     common = session.Common();
+  const TopoDS_Shape     cut    = session.Cut();
+  ASSERT_FALSE(common.IsNull());
+  ASSERT_FALSE(cut.IsNull());
+
+  // Section and split edges are created by the intersection, while every
+  // operation builds its own faces from them. Both results only contain the
+  // very same new edges if they were built from one intersection.
+  TopTools_IndexedMapOfShape inputEdges;
+  TopExp::MapShapes(box1, TopAbs_EDGE, inputEdges);
+  TopExp::MapShapes(box2, TopAbs_EDGE, inputEdges);
+  TopTools_IndexedMapOfShape cutEdges;
+  TopExp::MapShapes(cut, TopAbs_EDGE, cutEdges);
+  TopTools_IndexedMapOfShape commonEdges;
+  TopExp::MapShapes(common, TopAbs_EDGE, commonEdges);
+
+  size_t sharedNewEdges = 0;
+  for (int i = 1; i <= commonEdges.Extent(); i++)
+  {
+    if (!inputEdges.Contains(commonEdges(i)) && cutEdges.Contains(commonEdges(i)))
+    {
+      sharedNewEdges++;
+    }
+  }
+  EXPECT_GE(sharedNewEdges, 6u) << "At least the six section edges bound both results";
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, FuseBalancedTest_SmallInputIsFuse)
+{
+  NCollection_List<TopoDS_Shape> cubes;
+  for (int i = 0; i < 4; i++)
+  {
+    cubes.Append(primitive::MakeBox(gp_Pnt(i, 0, 0), gp_Pnt(i + 1.5, 1, 1)));
+  }
+
+  // At the leaf size, the shapes are fused by a single Fuse()
+  const TopoDS_Shape balanced = boolean::FuseBalanced(cubes, boolean::DefaultOptions(), 4);
+  const TopoDS_Shape fused    = boolean::Fuse(cubes);
+  ASSERT_FALSE(balanced.IsNull());
+  ASSERT_FALSE(fused.IsNull());
+
+  TopTools_IndexedMapOfShape balancedFaces;
+  TopExp::MapShapes(balanced, TopAbs_FACE, balancedFaces);
+  TopTools_IndexedMapOfShape fusedFaces;
+  TopExp::MapShapes(fused, TopAbs_FACE, fusedFaces);
+  EXPECT_EQ(balancedFaces.Extent(), fusedFaces.Extent());
+  EXPECT_NEAR(shape::Volume(balanced), shape::Volume(fused), 1e-6);
+  EXPECT_NEAR(shape::Volume(balanced), 4.5, 1e-6);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_boolean, FuseBalancedTest_TreeMatchesFuse)
+{
+  // A 4x4 grid of overlapping cubes, far more than a single leaf
+  NCollection_List<TopoDS_Shape> cubes;
+  for (int i = 0; i < 4; i++)
+  {
+    for (int j = 0; j < 4; j++)
+    {
+      cubes.Append(primitive::MakeBox(gp_Pnt(i, j, 0), gp_Pnt(i + 1.5, j + 1.5, 1)));
+    }
+  }
+
+  const TopoDS_Shape balanced = boolean::FuseBalanced(cubes, boolean::DefaultOptions(), 2);
+  const TopoDS_Shape fused    = boolean::Fuse(cubes);
+  ASSERT_FALSE(balanced.IsNull());
+  ASSERT_FALSE(fused.IsNull());
+
+  EXPECT_NEAR(shape::Volume(balanced), shape::Volume(fused), 1e-6);
+  EXPECT_NEAR(shape::Volume(balanced), 4.5 * 4.5, 1e-6);
+}
@@ -11,17 +11,30 @@
  *                                                                         *
  ***************************************************************************/
 
+// std includes
+#include <cmath>
+#include <vector>
+
 // gtest includes
 #include <gtest/gtest.h>
 
 // OCC includes
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <Bnd_Box.hxx>
 #include <Precision.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
 
 // occutils includes
+#include "occutils/occutils-bounding-box-broad-phase.h"
+#include "occutils/occutils-bounding-box-cache.h"
+#include "occutils/occutils-bounding-box-index.h"
 #include "occutils/occutils-bounding-box.h"
+#include "occutils/occutils-compound.h"
+#include "occutils/occutils-primitive.h"
 
 using namespace occutils::bbox;
 
@@ -268,3 +281,177 @@ TEST(test_bounding_box, ShapeTest_Handles3DBoundingBox)
   ASSERT_FALSE(result.IsNull()) << "Result is not null";
   ASSERT_TRUE(result.ShapeType() == TopAbs_SOLID) << "Result is a face";
 }
+
+//------------------------------------------------------------------------------
+
+TEST(test_bounding_box, IndexTest_Queries)
+{
+  // Ten unit cubes along the x-axis, at x = 0, 2, 4, ...
+  std::vector<TopoDS_Shape> shapes;
+  for (int i = 0; i < 10; i++)
+  {
+    shapes.push_back(occutils::primitive::MakeBox(gp_Pnt(2 * i, 0, 0), gp_Pnt(2 * i + 1, 1, 1)));
+  }
+  Index index(shapes);
+  ASSERT_EQ(index.Size(), 10u);
+
+  Bnd_Box query;
+  query.Update(3.5, 0.0, 0.0, 6.5, 1.0, 1.0);
+  EXPECT_EQ(index.Overlapping(query), (std::vector<size_t>{2, 3}));
+
+  const auto hits = index.HitByRay(gp_Ax1(gp_Pnt(-1, 0.5, 0.5), gp_Dir(1, 0, 0)));
+  ASSERT_EQ(hits.size(), 10u);
+  for (size_t i = 0; i < hits.size(); i++)
+  {
+    EXPECT_EQ(hits[i], i) << "Hits are ordered along the ray";
+  }
+  EXPECT_TRUE(index.HitByRay(gp_Ax1(gp_Pnt(-1, 0.5, 0.5), gp_Dir(-1, 0, 0))).empty());
+
+  double     distance = 0.0;
+  const auto nearest  = index.Nearest(gp_Pnt(9.4, 0.5, 0.5), &distance);
+  ASSERT_TRUE(nearest.has_value());
+  EXPECT_EQ(*nearest, 4u);
+  EXPECT_NEAR(distance, 0.4, Precision::Confusion());
+  EXPECT_EQ(index.KNearest(gp_Pnt(9.4, 0.5, 0.5), 3), (std::vector<size_t>{4, 5, 3}));
+
+  // Move the first cube far away and refit
+  gp_Trsf move;
+  move.SetTranslation(gp_Vec(100, 0, 0));
+  index.Update(0, shapes[0].Moved(TopLoc_Location(move)));
+  index.Refit();
+  query.SetVoid();
+  query.Update(99.5, 0.0, 0.0, 100.5, 1.0, 1.0);
+  EXPECT_EQ(index.Overlapping(query), (std::vector<size_t>{0}));
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_bounding_box, IndexTest_UpdateGeometry)
+{
+  // The second element has no geometry yet
+  const TopoDS_Shape cube = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1));
+  Index              index(std::vector<TopoDS_Shape>{cube, TopoDS_Shape()});
+
+  Bnd_Box query;
+  query.Update(-1.0, -1.0, -1.0, 2.0, 2.0, 2.0);
+  EXPECT_EQ(index.Overlapping(query), (std::vector<size_t>{0}));
+
+  // Gaining and losing geometry is reflected by the queries
+  index.Update(1, cube);
+  index.Refit();
+  EXPECT_EQ(index.Overlapping(query), (std::vector<size_t>{0, 1}));
+  index.Update(0, TopoDS_Shape());
+  index.Refit();
+  EXPECT_EQ(index.Overlapping(query), (std::vector<size_t>{1}));
+  EXPECT_TRUE(index.Box(0).IsVoid());
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_bounding_box, CacheTest_HitsAndCompounds)
+{
+  const TopoDS_Shape box = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+  gp_Trsf            move;
+  move.SetTranslation(gp_Vec(10, 0, 0));
+  const TopoDS_Shape moved = box.Moved(TopLoc_Location(move));
+
+  Cache cache;
+  EXPECT_NEAR(cache.Volume(box), Volume(box), Precision::Confusion());
+  EXPECT_EQ(cache.Misses(), 1u);
+  EXPECT_TRUE(cache.Size(box).IsEqual(Size(box), Precision::Confusion()));
+  EXPECT_EQ(cache.Hits(), 1u) << "Same TShape and location";
+
+  // The compound misses, its first child hits, the moved child misses
+  const TopoDS_Shape compound = occutils::compound::From(std::vector<TopoDS_Shape>{box, moved});
+  const auto [min, max]       = cache.BoundingBox(compound);
+  EXPECT_EQ(cache.Hits(), 2u);
+  EXPECT_EQ(cache.Misses(), 3u);
+  EXPECT_EQ(cache.Entries(), 3u);
+  EXPECT_NEAR(max.X() - min.X(), 11.0, 1e-3);
+
+  // Invalidation removes the box at both locations
+  cache.Invalidate(box);
+  EXPECT_EQ(cache.Entries(), 1u);
+  cache.Clear();
+  EXPECT_EQ(cache.Entries(), 0u);
+}
+
+TEST(test_bounding_box, ComputeTest_Modes)
+{
+  // A 10x1x1 bar rotated by 45 degrees around the z-axis. Being elongated,
+  // its oriented box is well-defined, unlike the one of a cube.
+  gp_Trsf rotation;
+  rotation.SetRotation(gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1)), M_PI / 4);
+  const TopoDS_Shape box = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 1, 1))
+                             .Moved(TopLoc_Location(rotation));
+
+  // Without triangulation, Fast falls back to Default
+  const BoundingBoxResult unmeshed = Compute(box, Mode::Fast);
+  EXPECT_EQ(unmeshed.mode, Mode::Default);
+
+  BRepMesh_IncrementalMesh mesh(box, 1.0);
+  const BoundingBoxResult  fast = Compute(box, Mode::Fast);
+  EXPECT_EQ(fast.mode, Mode::Fast);
+  EXPECT_NEAR(fast.Size().Z(), 1.0, 1e-3);
+
+  const BoundingBoxResult optimal = Compute(box, Mode::Optimal, true);
+  EXPECT_EQ(optimal.mode, Mode::Optimal);
+  EXPECT_NEAR(optimal.Size().X(), 11.0 / std::sqrt(2.0), 1e-3);
+  EXPECT_NEAR(optimal.Volume(), Compute(box, Mode::Optimal).Volume(), Precision::Confusion());
+
+  const BoundingBoxResult oriented = Compute(box, Mode::Oriented);
+  EXPECT_EQ(oriented.mode, Mode::Oriented);
+  EXPECT_LT(oriented.Volume(), 0.5 * optimal.Volume()) << "About 10 against 60.5";
+  EXPECT_FALSE(oriented.box.IsVoid());
+
+  EXPECT_TRUE(Compute(TopoDS_Shape(), Mode::Optimal, true).box.IsVoid());
+}
+
+TEST(test_bounding_box, BoundingBoxesTest_Arrays)
+{
+  const std::vector<TopoDS_Shape> shapes{
+    occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3)),
+    TopoDS_Shape(),
+    occutils::primitive::MakeBox(gp_Pnt(5, 5, 5), gp_Pnt(6, 6, 6))};
+
+  const BoundingBoxArrays boxes = BoundingBoxes(shapes, Mode::Fast);
+  ASSERT_EQ(boxes.Size(), 3u);
+  EXPECT_NEAR(boxes.xMin[0], 0.0, 1e-3);
+  EXPECT_NEAR(boxes.zMax[0], 3.0, 1e-3);
+  EXPECT_NEAR(boxes.yMin[2], 5.0, 1e-3);
+  // The null shape has a void box, which overlaps nothing
+  EXPECT_GT(boxes.xMin[1], boxes.xMax[1]);
+}
+
+TEST(test_bounding_box, SweepAndPruneTest_Instances)
+{
+  // Five instances of a unit cube along the x-axis at x = 0, 0.5, 3, 6, 9
+  const TopoDS_Shape cube = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1));
+
+  std::vector<SweepAndPrune::Instance> instances;
+  for (double x : {0.0, 0.5, 3.0, 6.0, 9.0})
+  {
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(x, 0, 0));
+    instances.push_back({cube, TopLoc_Location(move)});
+  }
+  SweepAndPrune broadPhase(instances);
+  ASSERT_EQ(broadPhase.Size(), 5u);
+  EXPECT_EQ(broadPhase.Axis(), 0);
+  EXPECT_EQ(broadPhase.Pairs(), (std::vector<std::pair<size_t, size_t>>{{0, 1}}));
+
+  // Move the last cube onto the third one
+  gp_Trsf move;
+  move.SetTranslation(gp_Vec(3.5, 0, 0));
+  broadPhase.Move(4, TopLoc_Location(move));
+  broadPhase.Sort();
+  EXPECT_EQ(broadPhase.Pairs({4}), (std::vector<std::pair<size_t, size_t>>{{2, 4}}));
+  EXPECT_EQ(broadPhase.Pairs(), (std::vector<std::pair<size_t, size_t>>{{0, 1}, {2, 4}}));
+
+  // Replacing the part of the fourth instance keeps its location at x = 6
+  broadPhase.Update(3, occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(2, 1, 1)));
+  broadPhase.Sort();
+  EXPECT_NEAR(broadPhase.Boxes().xMin[3], 6.0, 1e-3);
+  EXPECT_NEAR(broadPhase.Boxes().xMax[3], 8.0, 1e-3);
+  EXPECT_NEAR(broadPhase.Boxes().xMax[2], 4.0, 1e-3) << "Other instances keep the cube";
+}
@@ -0,0 +1,194 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+
+// gtest includes
+#include <gtest/gtest.h>
+
+// OCC includes
+#include <BRep_Tool.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Solid.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-compound.h"
+#include "occutils/occutils-primitive.h"
+#include "occutils/occutils-shape-components.h"
+#include "occutils/occutils-shape-query.h"
+#include "occutils/occutils-topology-index.h"
+#include "occutils/occutils-vertex-export.h"
+
+using namespace occutils;
+
+TEST(test_shape_components, TopologyIndexTest_Box)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+
+  const shape_components::TopologyIndex index(box);
+
+  EXPECT_EQ(index.Count(TopAbs_SOLID), 1u);
+  EXPECT_EQ(index.Count(TopAbs_SHELL), 1u);
+  EXPECT_EQ(index.Count(TopAbs_FACE), 6u);
+  EXPECT_EQ(index.Count(TopAbs_WIRE), 6u);
+  EXPECT_EQ(index.Count(TopAbs_EDGE), 12u) << "Shared edges are stored once";
+  EXPECT_EQ(index.Count(TopAbs_VERTEX), 8u) << "Shared vertices are stored once";
+
+  // IDs follow the explorer order
+  const auto faces = shape_components::AllFacesWithin(box);
+  ASSERT_EQ(index.Faces().size(), faces.size());
+  for (size_t i = 0; i < faces.size(); i++)
+  {
+    EXPECT_TRUE(index.Faces()[i].IsSame(faces[i]));
+    EXPECT_EQ(index.IdOf(faces[i]), i);
+  }
+  EXPECT_EQ(shape_components::CountX(index, TopAbs_EDGE), 12u);
+}
+
+TEST(test_shape_components, AllEdgesWithinTest_Unique)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+
+  EXPECT_EQ(shape_components::AllEdgesWithin(box).size(), 24u);
+  EXPECT_EQ(shape_components::AllEdgesWithin(box, true).size(), 12u);
+  EXPECT_EQ(shape_components::CountX(box, TopAbs_VERTEX), 48u);
+  EXPECT_EQ(shape_components::CountX(box, TopAbs_VERTEX, true), 8u);
+
+  // Shared sub-shapes are also deduplicated across the given shapes
+  const std::vector<TopoDS_Shape> shapes{box, box};
+  EXPECT_EQ(shape_components::AllVerticesWithin(shapes, true).size(), 8u);
+  EXPECT_EQ(shape_components::CountX(shapes, TopAbs_FACE, true), 6u);
+}
+
+TEST(test_shape_components, SubShapeRangeTest_Box)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+
+  // Same order as the eager variant
+  const auto faces = shape_components::AllFacesWithin(box);
+  size_t     i     = 0;
+  for (const TopoDS_Face& face : shape_components::Faces(box))
+  {
+    ASSERT_LT(i, faces.size());
+    EXPECT_TRUE(face.IsSame(faces[i++]));
+  }
+  EXPECT_EQ(i, faces.size());
+
+  // Filters compose: the top face is the only one without a vertex below z = 3
+  const auto isBelowTop = [](const TopoDS_Vertex& vertex)
+  { return BRep_Tool::Pnt(vertex).Z() < 3.0 - Precision::Confusion(); };
+  const auto isTop = [&isBelowTop](const TopoDS_Face& face)
+  { return shape_components::Filter(shape_components::Vertices(face), isBelowTop).IsEmpty(); };
+  size_t topFaces = 0;
+  for (const TopoDS_Face& face : shape_components::Filter(shape_components::Faces(box), isTop))
+  {
+    EXPECT_FALSE(face.IsNull());
+    topFaces++;
+  }
+  EXPECT_EQ(topFaces, 1u);
+  EXPECT_TRUE(shape_components::Shells(TopoDS_Shape()).IsEmpty());
+
+  EXPECT_FALSE(shape_components::TryGetSingleFace(box, false).has_value());
+  EXPECT_TRUE(shape_components::TryGetSingleFace(box, true).has_value());
+}
+
+TEST(test_shape_components, AllFacesWithinParallelTest_MatchesSequential)
+{
+  std::vector<TopoDS_Shape> shapes;
+  for (int i = 0; i < 16; i++)
+  {
+    shapes.push_back(primitive::MakeBox(gp_Pnt(3 * i, 0, 0), gp_Pnt(3 * i + 1, 2, 3)));
+  }
+  shapes.push_back(TopoDS_Shape());
+
+  const auto faces         = shape_components::AllFacesWithin(shapes);
+  const auto parallelFaces = shape_components::AllFacesWithinParallel(shapes);
+  ASSERT_EQ(parallelFaces.size(), faces.size());
+  for (size_t i = 0; i < faces.size(); i++)
+  {
+    EXPECT_TRUE(parallelFaces[i].IsSame(faces[i]));
+  }
+
+  const auto points         = shape_components::AllVertexCoordinatesWithin(shapes);
+  const auto parallelPoints = shape_components::AllVertexCoordinatesWithinParallel(shapes);
+  ASSERT_EQ(parallelPoints.size(), points.size());
+  for (size_t i = 0; i < points.size(); i++)
+  {
+    EXPECT_TRUE(parallelPoints[i].IsEqual(points[i], 0.0));
+  }
+
+  EXPECT_EQ(shape_components::CountXParallel(shapes, TopAbs_EDGE),
+            shape_components::CountX(shapes, TopAbs_EDGE));
+}
+
+TEST(test_shape_components, ExportVertexCoordinatesTest_Merge)
+{
+  // Two unsewn boxes touching at x = 1, with 4 coincident vertices
+  const std::vector<TopoDS_Solid> boxes{primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1)),
+                                        primitive::MakeBox(gp_Pnt(1, 0, 0), gp_Pnt(2, 1, 1))};
+  const shape_components::TopologyIndex index(compound::From(boxes));
+  ASSERT_EQ(index.Count(TopAbs_VERTEX), 16u);
+
+  const auto separate = shape_components::ExportVertexCoordinates(index);
+  EXPECT_EQ(separate.Size(), 16u);
+  EXPECT_EQ(separate.x.size(), 16u);
+  EXPECT_TRUE(separate.xyz.empty());
+
+  const auto merged = shape_components::ExportVertexCoordinates(
+    index, shape_components::CoordinateLayout::Interleaved, true, Precision::Confusion());
+  ASSERT_EQ(merged.Size(), 12u);
+  ASSERT_EQ(merged.pointOfVertex.size(), 16u);
+  for (size_t vertex = 0; vertex < 16; vertex++)
+  {
+    const gp_Pnt expected = BRep_Tool::Pnt(index.Vertices()[vertex]);
+    const int    point    = merged.pointOfVertex[vertex];
+    EXPECT_TRUE(expected.IsEqual(
+      gp_Pnt(merged.xyz[3 * point], merged.xyz[3 * point + 1], merged.xyz[3 * point + 2]),
+      Precision::Confusion()));
+  }
+
+  // Caller-provided buffers
+  std::vector<double> x(16), y(16), z(16);
+  EXPECT_EQ(shape_components::ExportVertexCoordinates(
+              index, x.data(), y.data(), z.data(), nullptr, Precision::Confusion()),
+            12u);
+}
+
+TEST(test_shape_components, ShapeQueryTest_Box)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+
+  const auto isTopVertex = [](const TopoDS_Vertex& vertex)
+  { return BRep_Tool::Pnt(vertex).Z() > 3.0 - Precision::Confusion(); };
+
+  EXPECT_TRUE(shape_components::Any<TopoDS_Vertex>(box, isTopVertex));
+  EXPECT_FALSE(shape_components::Any<TopoDS_Vertex>(
+    box, [](const TopoDS_Vertex& vertex) { return BRep_Tool::Pnt(vertex).Z() > 4.0; }));
+
+  const auto topVertex = shape_components::FindFirst<TopoDS_Vertex>(box, isTopVertex);
+  ASSERT_TRUE(topVertex.has_value());
+  EXPECT_NEAR(BRep_Tool::Pnt(*topVertex).Z(), 3.0, Precision::Confusion());
+
+  EXPECT_TRUE(shape_components::CountAtMost<TopoDS_Solid>(box, 1));
+  EXPECT_FALSE(shape_components::CountAtMost<TopoDS_Face>(box, 5));
+
+  const auto [top, rest] = shape_components::Partition<TopoDS_Vertex>(box, isTopVertex);
+  EXPECT_EQ(top.size() + rest.size(), 48u);
+  EXPECT_EQ(top.size(), 24u) << "Explorer visits the shared top vertices once per edge";
+
+  // Runtime variants
+  EXPECT_TRUE(shape_components::Any(
+    box, TopAbs_FACE, [](const TopoDS_Shape& face) { return !face.IsNull(); }));
+  EXPECT_TRUE(shape_components::CountAtMost(box, TopAbs_EDGE, 24));
+  EXPECT_FALSE(shape_components::CountAtMost(box, TopAbs_EDGE, 23));
+}
@@ -0,0 +1,103 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+
+// std includes
+#include <vector>
+
+// gtest includes
+#include <gtest/gtest.h>
+
+// OCC includes
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <TopoDS_Solid.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
+
+// occutils includes
+#include "occutils/occutils-primitive.h"
+#include "occutils/occutils-slicer.h"
+
+using namespace occutils;
+
+TEST(test_slicer, SliceTest_Box)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 10));
+
+  // Heights are given unsorted and one of them misses the box
+  const std::vector<slicer::Layer> layers =
+    slicer::Slice(box, gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1)), {7.5, 2.5, 20.0, 5.0});
+
+  ASSERT_EQ(layers.size(), 4u);
+  EXPECT_DOUBLE_EQ(layers[0].height, 2.5);
+  EXPECT_DOUBLE_EQ(layers[3].height, 20.0);
+  for (size_t i = 0; i < 3; i++)
+  {
+    EXPECT_FALSE(layers[i].failed);
+    EXPECT_EQ(layers[i].wires.size(), 1u) << "Every layer is a single square";
+    EXPECT_EQ(layers[i].openWires, 0u);
+  }
+  EXPECT_TRUE(layers[3].wires.empty()) << "The plane above the box cuts nothing";
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_slicer, SliceUniformTest_LayerCount)
+{
+  const TopoDS_Solid box = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 10));
+
+  const std::vector<slicer::Layer> layers =
+    slicer::SliceUniform(box, gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1)), 1.0);
+
+  ASSERT_GE(layers.size(), 10u);
+  EXPECT_NEAR(layers.front().height, 0.5, 1e-3);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(test_slicer, SliceTest_ParallelMatchesSequential)
+{
+  // Every side face of the box spans all layers and is sectioned concurrently
+  const TopoDS_Solid box    = primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(10, 10, 10));
+  const gp_Ax1       axis   = gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1));
+  const auto         length = [](const slicer::Layer& layer)
+  {
+    double ret = 0.0;
+    for (const TopoDS_Wire& wire : layer.wires)
+    {
+      GProp_GProps gprops;
+      BRepGProp::LinearProperties(wire, gprops);
+      ret += gprops.Mass();
+    }
+    return ret;
+  };
+
+  const std::vector<slicer::Layer> parallelLayers =
+    slicer::SliceUniform(box, axis, 0.5, boolean::DefaultOptions(), 0);
+  const std::vector<slicer::Layer> sequentialLayers =
+    slicer::SliceUniform(box, axis, 0.5, boolean::DefaultOptions(), 1);
+
+  ASSERT_EQ(parallelLayers.size(), sequentialLayers.size());
+  ASSERT_GE(parallelLayers.size(), 20u);
+  for (size_t i = 0; i < parallelLayers.size(); i++)
+  {
+    EXPECT_FALSE(parallelLayers[i].failed);
+    EXPECT_DOUBLE_EQ(parallelLayers[i].height, sequentialLayers[i].height);
+    EXPECT_EQ(parallelLayers[i].wires.size(), sequentialLayers[i].wires.size());
+    EXPECT_EQ(parallelLayers[i].openWires, sequentialLayers[i].openWires);
+    EXPECT_NEAR(length(parallelLayers[i]), length(sequentialLayers[i]), 1e-6);
+    EXPECT_NEAR(length(parallelLayers[i]), 40.0, 1e-6) << "Every layer is the square perimeter";
+  }
+}
@@ -0,0 +1,110 @@
+/***************************************************************************
+ *   Created on: 16 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the occutils library.                            *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the Apache License version 2.0 as        *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ ***************************************************************************/
+
+
+// std includes
+#include <cmath>
+#include <vector>
+
+// gtest includes
+#include <gtest/gtest.h>
+
+// OCC includes
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+// occutils includes
+#include "occutils/occutils-face-table.h"
+#include "occutils/occutils-face.h"
+#include "occutils/occutils-primitive.h"
+#include "occutils/occutils-shape-components.h"
+#include "occutils/occutils-surface-cache.h"
+#include "occutils/occutils-surface-grid.h"
+
+using namespace occutils::surface;
+
+TEST(test_surface, EvaluateGridsTest_Box)
+{
+  const TopoDS_Shape box   = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 2, 3));
+  const auto         faces = occutils::shape_components::AllFacesWithin(box);
+  ASSERT_EQ(faces.size(), 6u);
+
+  const GridSamples samples = EvaluateGrids(faces, 3, 4, true);
+  ASSERT_EQ(samples.Size(), 6u * 12u);
+  ASSERT_EQ(samples.dvz.size(), samples.Size());
+  for (size_t i = 0; i < samples.Size(); i++)
+  {
+    EXPECT_GE(samples.x[i], -1e-9);
+    EXPECT_LE(samples.z[i], 3.0 + 1e-9);
+    const double length = std::sqrt(samples.nx[i] * samples.nx[i] + samples.ny[i] * samples.ny[i]
+                                     + samples.nz[i] * samples.nz[i]);
+    EXPECT_NEAR(length, 1.0, 1e-9);
+  }
+
+  // The grid spans the face, not the infinite plane
+  const GridSamples single = EvaluateGrid(faces[0], UniformUVGrid(faces[0], 3, 4));
+  ASSERT_EQ(single.Size(), 12u);
+  EXPECT_TRUE(single.dux.empty());
+  for (size_t i = 0; i < single.Size(); i++)
+  {
+    EXPECT_DOUBLE_EQ(single.x[i], samples.x[i]);
+    EXPECT_DOUBLE_EQ(single.nz[i], samples.nz[i]);
+  }
+}
+
+TEST(test_surface, FaceTableTest_Cylinder)
+{
+  const TopoDS_Shape cylinder = occutils::primitive::MakeCylinder(2.0, 5.0);
+
+  occutils::surfaces::FaceTable table(cylinder);
+  ASSERT_EQ(table.Size(), 3u);
+  EXPECT_EQ(table.Statistics().Count(GeomAbs_Plane), 2u);
+
+  const auto lateral = table.Only(GeomAbs_Cylinder);
+  ASSERT_EQ(lateral.size(), 1u);
+  EXPECT_NEAR(table.Area(lateral[0]), M_PI * 2.0 * 5.0, 1e-6);
+  EXPECT_NEAR(table.CenterOfMass(lateral[0]).Z(), 2.5, 1e-6);
+
+  const auto caps = table.Filter([&](size_t row) { return table.Area(row) < 4.0; });
+  EXPECT_EQ(caps, table.Only(GeomAbs_Plane));
+  EXPECT_EQ(table.SurfaceInfos(caps).size(), 2u);
+}
+
+TEST(test_surface, FromFaceTest_Location)
+{
+  gp_Trsf move;
+  move.SetTranslation(gp_Vec(0, 0, 10));
+  const TopoDS_Shape box = occutils::primitive::MakeBox(gp_Pnt(0, 0, 0), gp_Pnt(1, 1, 1))
+                             .Moved(TopLoc_Location(move));
+  const auto faces = occutils::shape_components::AllFacesWithin(box);
+
+  AdaptorCache cache;
+  for (const TopoDS_Face& face : faces)
+  {
+    const GeomAdaptor_Surface stored = FromFace(face, SurfaceLookup::Stored);
+    const GeomAdaptor_Surface search = FromFace(face, SurfaceLookup::Search);
+    const gp_Pnt              point  = PointAt(stored, 0.5, 0.5);
+    EXPECT_GE(point.Z(), 10.0 - 1e-9) << "The surface is placed at the face location";
+    EXPECT_TRUE(point.IsEqual(PointAt(search, 0.5, 0.5), 1e-9));
+
+    const auto normal = occutils::face::NormalDirection(face, cache, 0.5, 0.5);
+    ASSERT_TRUE(normal.has_value());
+    EXPECT_TRUE(normal->IsEqual(*occutils::face::NormalDirection(face, 0.5, 0.5), 1e-9));
+    EXPECT_TRUE(&cache.Get(face) == &cache.Get(face));
+  }
+  EXPECT_EQ(cache.Size(), faces.size());
+}